@@ -177,8 +177,9 @@ int mainLoop(GameInstance *currentGame) {
         if (currentGame->getCollision(playerPtr, obstaclePtr)) printf("CONTACT TRUE\n");
         // Update player position
         if (SHOW_FPS) {  // use sampleSize to find average FPS
-            times.push_back(deltaTime);
-            currentTime += deltaTime;
+            auto frameTime = currentGame->getFrameContext().realDeltaTime;
+            times.push_back(frameTime);
+            currentTime += frameTime;
             if (currentTime > sampleTime) {
                 currentTime = 0.0f;
                 double sum = 0.0;
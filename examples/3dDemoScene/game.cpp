@@ -51,6 +51,7 @@ vector<ProgramData> programs = {
 GameInstance *currentGame;
 
 extern std::unique_ptr<GfxController> gfxController;
+extern std::unique_ptr<JobSystem> jobSystem;
 extern std::unique_ptr<AnimationController> animationController;
 extern std::unique_ptr<PhysicsController> physicsController;
 extern std::unique_ptr<InputController> inputController;
@@ -111,31 +112,36 @@ int runtime() {
     // Start the background music
     currentGame->playSound("bg_music", 1, 60);
 
+    // Parse every model for the scene up front in parallel
+    auto polygons = ModelImport::createPolygonsFromFiles({
+        "src/resources/models/Forest Scene Tri.obj",
+        "src/resources/models/Dracula.obj",
+        "src/resources/models/human.obj",
+        "src/resources/models/wolf.obj"
+    }, jobSystem.get());
+
     cout << "Creating Map.\n";
 
-    auto mapPoly = ModelImport::createPolygonFromFile("src/resources/models/Forest Scene Tri.obj");
+    auto mapPoly = polygons[0];
 
-    auto mapObjects = currentGame->createGameObjectBatch(mapPoly,
-        vec3(-0.006f, -0.019f, 0.0f), vec3(0.0f, 0.0f, 0.0f), 1.0f, "map");
+    auto mapObject = currentGame->createGameObject(mapPoly, vec3(-0.006f, -0.019f, 0.0f), vec3(0.0f, 0.0f, 0.0f),
+        1.0f, "map");
 
-    // Generate a collider for each object
-    for (auto object : mapObjects) {
-        object->createCollider("map");
-        physicsController->addSceneObject(object, {
-            .isKinematic = false,
-            .obeyGravity = false,
-            .elasticity = 0.0f,
-            .mass = 5.0f
-        });
-    }
+    // The collider box only bounds the map for the broadphase - the mesh collider handles the actual terrain
+    mapObject->createCollider("map");
+    physicsController->addSceneObject(mapObject, {
+        .isKinematic = false,
+        .obeyGravity = false,
+        .elasticity = 0.0f,
+        .mass = 5.0f,
+        .mesh = MeshCollider::fromPolygon(*mapPoly)
+    });
 
     cout << "Creating Player\n";
 
-    auto playerPoly = ModelImport::createPolygonFromFile(
-        "src/resources/models/Dracula.obj");
+    auto playerPoly = polygons[1];
 
-    auto companionPoly = ModelImport::createPolygonFromFile(
-        "src/resources/models/human.obj");
+    auto companionPoly = polygons[2];
 
     // Ready the gameObjectInfo for the player object
     auto playerRef = currentGame->createGameObject(playerPoly, vec3(0.0f, 0.0f, -1.0f),
@@ -161,7 +167,7 @@ int runtime() {
 
     cout << "Creating wolf\n";
 
-    auto wolfPoly = ModelImport::createPolygonFromFile("src/resources/models/wolf.obj");
+    auto wolfPoly = polygons[3];
 
     auto wolfObject = currentGame->createGameObject(wolfPoly,
         vec3(-11.0f, 1.6f, 6.0f), vec3(0.0f, 0.0f, 0.0f), 1.0f, "NPC");
@@ -322,8 +328,9 @@ int mainLoop() {
         }
 
         if (SHOW_FPS) {  // use sampleSize to find average FPS
-            times.push_back(deltaTime);
-            currentTime += deltaTime;
+            auto frameTime = currentGame->getFrameContext().realDeltaTime;
+            times.push_back(frameTime);
+            currentTime += frameTime;
             if (currentTime > sampleTime) {
                 currentTime = 0.0f;
                 double sum = 0.0;
@@ -35,6 +35,7 @@ extern std::unique_ptr<InputController> inputController;
 extern std::unique_ptr<AnimationController> animationController;
 extern std::unique_ptr<PhysicsController> physicsController;
 #define PI 3.14159265
+#define BULLET_LAYER 2u
 
 void updateAttachStatus();
 
@@ -50,6 +51,8 @@ void updateAttachStatus();
 void rotateShape(void *target) {
     int numJoySticks = SDL_NumJoysticks();
     GameObject *character = reinterpret_cast<GameObject *>(target);  // GameObject to rotate
+    // Look the player body up once - handle calls are queued without waiting on the physics pipeline
+    auto characterHandle = physicsController->getHandle(character->objectName());
     float currentLuminance = 1.0f;
     auto fpsMode = false;
     /** Input map code example from BOTHWORLDS */
@@ -265,9 +268,13 @@ void rotateShape(void *target) {
                     .isKinematic = true,
                     .obeyGravity = false,
                     .elasticity = 0.0f,
-                    .mass = 1.0f
+                    .mass = 1.0f,
+                    .continuousCollision = true,  // Bullets are fast and small enough to skip through walls
+                    // Bullets hit everything except other bullets
+                    .collisionLayer = BULLET_LAYER,
+                    .collisionMask = ~BULLET_LAYER
                 };
-                physicsController->addSceneObject(bulletObj, params);
+                auto bulletHandle = physicsController->addSceneObject(bulletObj, params);
                 // Convert angles[1] to a direction????
                 //auto anglex = std::cos(angles.y * (PI/180.0) - (PI/2.0));
                 //auto anglez = std::sin(angles.y * (PI/180.0) + (PI/2.0));
@@ -276,7 +283,7 @@ void rotateShape(void *target) {
                 // angles.y is the rotation of the character on some axis??
                 printf("Detected rot %f %f %f\n", charAngle.x, charAngle.y, charAngle.z);
 
-                physicsController->setVelocity(bulletName, vec3(ray.x * magnitude, 0.0f, ray.z * magnitude));
+                physicsController->setVelocity(bulletHandle, vec3(ray.x * magnitude, 0.0f, ray.z * magnitude));
             }
         }
         // Set character rotation based on joysticks
@@ -286,7 +293,7 @@ void rotateShape(void *target) {
             angle += controllerLeftStateX > 0.0f ? 90.0f : 270.0f;
             UPDATE_CHAR_ANGLE((fpsMode ? -angle + 180.0f : -angle));
         }
-        physicsController->setVelocity("player", travelVel);
+        physicsController->setVelocity(characterHandle, travelVel);
         currentGame->protectedGfxRequest([&] () {
             currentGame->setLuminance(currentLuminance);
             character->setRotation(charAngle);
@@ -5,6 +5,7 @@ runBuild=false
 embeddedBuild=false
 debugBuild=false
 runTests=false
+buildBench=false
 singleJob=false
 buildAll=false
 installLib=false
@@ -26,6 +27,10 @@ while [ $# -ne 0 ]; do
         -t)
             runTests=true
             ;;
+        -b)
+            # Builds the microbenchmarks alongside the engine
+            buildBench=true
+            ;;
         -tf)
             shift
             test_filter="$1"
@@ -77,7 +82,7 @@ cd build
 # If -d flag is present, build in debug mode
 if "$debugBuild"; then
     echo "RUNNING UNDER DEBUG MODE"
-    ARGS="-DCMAKE_EXPORT_COMPILE_COMMANDS=1 -DCMAKE_BUILD_TYPE=Debug"
+    ARGS="-DCMAKE_EXPORT_COMPILE_COMMANDS=1 -DCMAKE_BUILD_TYPE=Debug -DGFX_DEBUG=1"
 else
     echo "RUNNING UNDER RELEASE MODE"
     ARGS="-Wno-dev -DCMAKE_EXPORT_COMPILE_COMMANDS=1 -DCMAKE_BUILD_TYPE=Release"
@@ -94,6 +99,10 @@ if "$runTests"; then
     echo "Compiling tests"
     ARGS="$ARGS -DRUNTEST=1"
 fi
+if "$buildBench"; then
+    echo "Compiling benchmarks"
+    ARGS="$ARGS -DBENCHMARK=1"
+fi
 # Pass phys threads through
 ARGS="$ARGS -DPHYS_THREADS=$physThreads"
 
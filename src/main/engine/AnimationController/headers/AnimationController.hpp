@@ -24,6 +24,8 @@
 #include <TextObject.hpp>
 #include <SpriteObject.hpp>
 #include <studious_utility.hpp>
+#include <JobSystem.hpp>
+#include <FrameContext.hpp>
 
 // Update return values
 #define UPDATE_NOT_COMPLETE 0
@@ -52,8 +54,6 @@
 #define CAP_NEG 2
 #define ANIMATION_COMPLETE_CB std::function<void(void)> callback
 
-extern double deltaTime;
-
 template <typename T>
 class AnimationData {
  public:
@@ -129,6 +129,7 @@ struct KeyFrame {
 struct KeyFrames {
     std::queue<std::shared_ptr<KeyFrame>> kQueue;
     SceneObject *target;
+    uint textKeyFrames = 0;  // Key frames in kQueue with UPDATE_TEXT set
 };
 
 struct KeyFrameEntry {
@@ -141,7 +142,27 @@ class AnimationController {
     int addKeyFrame(SceneObject *target, std::shared_ptr<KeyFrame> keyFrame);
     int addKeyFrameEntry(KeyFrameEntry kfEntry);
     void addTrack(TrackExt *target, string trackName, vector<int> trackData, int fps, bool loop);
+    /**
+     * @brief Advances every key frame queue and running track by the frame's scaled delta time.
+     * @param frame Timing of the frame being updated.
+     */
+    void update(const FrameContext &frame);
+    // Same as update(frame) with a frame built from the deltaTime global, for callers without a FrameContext
     void update();
+    /**
+     * @brief Runs the key frames for a single object, moving onto the next key frame when time overflows.
+     * @param keyFrames The object's key frame queue.
+     * @param timeChange Seconds to advance the key frames by.
+     * @param callbacks Output list of callbacks for key frames that finished during this update.
+     * @return true when the object's key frame queue has been emptied, false otherwise.
+     */
+    bool updateKeyFrames(KeyFrames *keyFrames, float timeChange, vector<std::function<void(void)>> *callbacks);
+    /**
+     * @brief Sets the job system used to update key frames for multiple objects in parallel. Objects with text key
+     * frames are always updated on the calling thread since text updates touch the graphics API.
+     * @param jobSystem Engine job system, or nullptr to update everything on the calling thread.
+     */
+    inline void setJobSystem(JobSystem *jobSystem) { jobSystem_ = jobSystem; }
     UpdateData<float> updateKeyFrame(SceneObject *target, std::shared_ptr<KeyFrame> currentKf, float timeChange);
     int updatePosition(SceneObject *target, KeyFrame *keyFrame);
     int updateRotation(SceneObject *target, KeyFrame *keyFrame);
@@ -150,7 +171,7 @@ class AnimationController {
     int updateText(SceneObject *target, KeyFrame *keyFrame);
     int updateTime(KeyFrame *keyFrame);
     /**
-     * @brief Processes the color keyframe if applicable using deltaTime.
+     * @brief Processes the color keyframe if applicable using the keyframe's elapsed time.
      * @param target - The SceneObject to apply the animation to.
      * @param keyFrame - The KeyFrame to process.
      * @return COLOR_MET if keyframe has completed, or UPDATE_NOT_COMPLETE otherwise. COLOR_MET is also
@@ -158,14 +179,15 @@ class AnimationController {
      */
     int updateColor(SceneObject *target, KeyFrame *keyFrame);
     int updateTint(SceneObject *target, KeyFrame *keyFrame);
-    bool updateTrack(std::shared_ptr<ActiveTrackEntry> trackPlayback);
+    bool updateTrack(std::shared_ptr<ActiveTrackEntry> trackPlayback, double timeChange);
     static std::shared_ptr<KeyFrame> createKeyFrameCb(int type, ANIMATION_COMPLETE_CB, float time);
     static std::shared_ptr<KeyFrame> createKeyFrame(int type, float time);
     static bool cap(float *cur, float target, float dv);
     float linearFloatTransform(float original, float desired, KeyFrame *keyFrame);
     /**
      * @brief Linearly transforms a vector's values given the current values, the original values and the desired values.
-     * Uses deltaTime to determine updated values. Will set current = desired when the keyframe is finished.
+     * Uses the keyframe's elapsed time to determine updated values. Will set current = desired when the keyframe is
+     * finished.
      * @param original - The original vector for the SceneObject when the keyframe began processing.
      * @param desired - The desired vector values for the SceneObject upon keyframe completion.
      * @param current - The current vector values for the current keyframe. These values are applied to the target
@@ -197,4 +219,5 @@ class AnimationController {
     /* Map of object name to active track */
     map<string, std::shared_ptr<ActiveTrackEntry>> activeTracks_;
     std::mutex controllerLock_;
+    JobSystem *jobSystem_ = nullptr;
 };
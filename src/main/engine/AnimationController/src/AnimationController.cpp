@@ -18,6 +18,9 @@
 #include <ImageExt.hpp>
 #include <SceneObject.hpp>
 
+// Only read by the legacy update() overload - everything else works from the FrameContext it is handed
+extern double deltaTime;
+
 std::shared_ptr<KeyFrame> AnimationController::createKeyFrameCb(int type, ANIMATION_COMPLETE_CB, float time) {
     auto keyframe = createKeyFrame(type, time);
     keyframe.get()->callback = callback;
@@ -164,6 +167,7 @@ int AnimationController::addKeyFrame(SceneObject *target, std::shared_ptr<KeyFra
     // Check if the target object exists in the keyframestore
     auto it = keyFrameStore_.find(targetName);
     auto kfQueueSize = 0;
+    auto isText = (keyFrame->type & UPDATE_TEXT) != 0;
 
     // If the target exists in the key store, do some sanity checks...
     if (it != keyFrameStore_.end()) {
@@ -171,11 +175,14 @@ int AnimationController::addKeyFrame(SceneObject *target, std::shared_ptr<KeyFra
         assert(it->second.target == target);
         // Add the keyFrame to the object's keyframe queue
         it->second.kQueue.push(keyFrame);
+        it->second.textKeyFrames += isText;
         kfQueueSize = it->second.kQueue.size();
     } else {
         // If the object has no keyframestore, add it
-        keyFrameStore_[target->objectName()].kQueue.push(keyFrame);
-        keyFrameStore_[target->objectName()].target = target;
+        auto &keyFrames = keyFrameStore_[target->objectName()];
+        keyFrames.kQueue.push(keyFrame);
+        keyFrames.target = target;
+        keyFrames.textKeyFrames = isText;
         kfQueueSize = 1;
     }
     return kfQueueSize;
@@ -230,35 +237,72 @@ UpdateData<float> AnimationController::updateKeyFrame(SceneObject *target, std::
     return UpdateData<float>(overflowTime - targetTime, (result == done));
 }
 
+bool AnimationController::updateKeyFrames(KeyFrames *keyFrames, float timeChange,
+    vector<std::function<void(void)>> *callbacks) {
+    auto isOverflow = false;
+    do {
+        // Grab the front keyFrame for the object
+        auto currentKf = keyFrames->kQueue.front();
+        auto target = keyFrames->target;
+        auto result = updateKeyFrame(target, currentKf, timeChange);
+        // Only remove the keyframe when all updates are done...
+        if (result.updateComplete_) {
+            printf("AnimationController::update: Finished keyframe for %s\n", target->objectName().c_str());
+            // Remove the keyframe from the queue
+            keyFrames->kQueue.pop();
+            if (currentKf->type & UPDATE_TEXT) keyFrames->textKeyFrames--;
+            // Call the callback associated with the keyframe
+            if (currentKf->hasCb) callbacks->push_back(currentKf->callback);
+        }
+        // Move onto the next key frame if overflow time has been detected and a next keyframe exists
+        isOverflow = result.updatedValue_ > 0.0f && !keyFrames->kQueue.empty();
+        timeChange = result.updatedValue_;
+    } while (isOverflow);
+    return keyFrames->kQueue.empty();
+}
+
 void AnimationController::update() {
+    update(FrameContext::fromDeltaTime(deltaTime));
+}
+
+void AnimationController::update(const FrameContext &frame) {
+    float timeChange = frame.deltaTime;
     // Lock the controller
     std::unique_lock<std::mutex> scopeLock(controllerLock_);
     vector<std::function<void(void)>> callbacks;
     vector<string> deferredDelete;
-    auto isOverflow = false;
-    float timeChange = deltaTime;
-    // Run update methods on each object here
+    // Each object's key frames only touch that object, so objects can be updated independently
+    vector<KeyFrames *> entries;
     for (auto &entry : keyFrameStore_) {
-        do {
-            // Grab the front keyFrame for the object
-            auto currentKf = entry.second.kQueue.front();
-            auto target = entry.second.target;
-            auto result = updateKeyFrame(target, currentKf, timeChange);
-            // Only remove the keyframe when all updates are done...
-            if (result.updateComplete_) {
-                printf("AnimationController::update: Finished keyframe for %s\n", target->objectName().c_str());
-                // Remove the keyframe from the queue
-                entry.second.kQueue.pop();
-                // Call the callback associated with the keyframe
-                if (currentKf->hasCb) callbacks.push_back(currentKf->callback);
-                if (entry.second.kQueue.empty())
-                    deferredDelete.push_back(entry.first);
-            }
-            // Move onto the next key frame if overflow time has been detected and a next keyframe exists
-            isOverflow = result.updatedValue_ > 0.0f && !entry.second.kQueue.empty();
-            timeChange = result.updatedValue_;
-        } while (isOverflow);
-        timeChange = deltaTime;  // Reset timeChange for the next keyframe
+        entries.push_back(&entry.second);
+    }
+    vector<vector<std::function<void(void)>>> entryCallbacks(entries.size());
+    vector<char> entryEmpty(entries.size(), 0);
+    auto runEntry = [this, &entries, &entryCallbacks, &entryEmpty, timeChange](uint index) {
+        entryEmpty[index] = updateKeyFrames(entries[index], timeChange, &entryCallbacks[index]);
+    };
+    if (jobSystem_ != nullptr && entries.size() > 1) {
+        // Text updates rebuild VAOs, so those objects stay on this thread
+        vector<uint> parallelEntries;
+        vector<uint> serialEntries;
+        for (uint i = 0; i < entries.size(); ++i) {
+            (entries[i]->textKeyFrames > 0 ? serialEntries : parallelEntries).push_back(i);
+        }
+        auto keyFrameJob = jobSystem_->parallelFor(parallelEntries.size(), 0,
+            [&runEntry, &parallelEntries](uint begin, uint end) {
+                for (uint i = begin; i < end; ++i) runEntry(parallelEntries[i]);
+            });
+        for (auto index : serialEntries) runEntry(index);
+        jobSystem_->wait(keyFrameJob);
+    } else {
+        for (uint i = 0; i < entries.size(); ++i) runEntry(i);
+    }
+    // Merge results in store order so callbacks fire in the same order as a serial update
+    uint index = 0;
+    for (auto &entry : keyFrameStore_) {
+        callbacks.insert(callbacks.end(), entryCallbacks[index].begin(), entryCallbacks[index].end());
+        if (entryEmpty[index]) deferredDelete.push_back(entry.first);
+        ++index;
     }
     // Erase keys in the deferredDelete list
     for (auto item : deferredDelete) {
@@ -271,7 +315,7 @@ void AnimationController::update() {
         auto state = entry.second.get()->state;
         if (state == TrackState::RUNNING) {
             /* Update the active track */
-            if (updateTrack(entry.second)) {
+            if (updateTrack(entry.second, frame.deltaTime)) {
                 deferredDelete.push_back(entry.first);
             }
         }
@@ -490,16 +534,17 @@ int AnimationController::updateTime(KeyFrame *keyFrame) {
 
 /**
  * @brief Updates the currently rendered frame of the target TrackExt based on framerate of animation track,
- * deltaTime, and data from the track.
+ * the frame time, and data from the track.
  * @param trackPlayback The active track to update.
+ * @param timeChange Seconds to advance the track by.
  * @return true if the track is complete, false if it's still ongoing.
  */
-bool AnimationController::updateTrack(std::shared_ptr<ActiveTrackEntry> trackPlayback) {
+bool AnimationController::updateTrack(std::shared_ptr<ActiveTrackEntry> trackPlayback, double timeChange) {
     auto tp = trackPlayback.get();
     auto target = trackPlayback.get()->target;
     auto track = tp->track.get()->trackData;
     /* Update timings and current frame */
-    tp->currentTime += deltaTime;
+    tp->currentTime += timeChange;
     /* Break the update early if loop is enabled */
     if (!tp->track.get()->loop && tp->currentTime >= tp->sequenceTime) {
         target->setCurrentFrame(tp->track.get()->trackData.at(tp->track.get()->trackData.size() - 1));
@@ -8,3 +8,6 @@
 #pragma once
 #include <AnimationController.hpp>
 #include <TestObject.hpp>
+
+// The tests drive AnimationController::update() through the legacy global
+extern double deltaTime;
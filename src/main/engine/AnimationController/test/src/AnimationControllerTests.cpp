@@ -941,6 +941,32 @@ TEST_F(GivenAnAnimationControllerReady, WhenTextTransformationCompletes_ThenText
     ASSERT_EQ(desiredText, obj.getMessage());
 }
 
+/**
+ * @brief Ensures the text key frame count of an object follows its queue, so update knows which objects to keep on
+ * the updating thread without walking their queues.
+ */
+TEST_F(GivenAnAnimationControllerReady, WhenTextKeyFrameFinishes_ThenTextKeyFrameCountDrops) {
+    /* Preparation */
+    TextObject obj("", vec3(0), 1.0f, testFontPath, 1.0f, 10, 0, 0, TEST_OBJECT_NAME,
+        ObjectType::TEXT_OBJECT, &dummyGfxController_);
+    deltaTime = 1.0f;
+    auto textKeyFrame = AnimationController::createKeyFrame(UPDATE_TEXT, 1.0f);
+    textKeyFrame->text.desired = "Hello";
+    auto posKeyFrame = AnimationController::createKeyFrame(UPDATE_POS, 5.0f);
+    posKeyFrame->pos.desired = vec3(5.0f);
+    animationController_.addKeyFrame(&obj, textKeyFrame);
+    animationController_.addKeyFrame(&obj, posKeyFrame);
+    auto countBeforeUpdate = animationController_.getKeyFrameStore().at(TEST_OBJECT_NAME).textKeyFrames;
+
+    /* Action */
+    animationController_.update();
+
+    /* Validation */
+    ASSERT_EQ(1u, countBeforeUpdate);
+    ASSERT_EQ(1, animationController_.getKeyFrameStore().at(TEST_OBJECT_NAME).kQueue.size());
+    ASSERT_EQ(0u, animationController_.getKeyFrameStore().at(TEST_OBJECT_NAME).textKeyFrames);
+}
+
 /**
  * @brief Ensures that keyframes with a zero time do not crash the animation controller, and that
  * the object is updated immediately to the desired state.
@@ -1004,3 +1030,71 @@ TEST_F(GivenAnAnimationControllerReady, WhenKeyFrameTimeOverflows_ThenNextKeyFra
     ASSERT_EQ(expectedTransformation, obj.getScale());
     ASSERT_TRUE(animationController_.getKeyFrameStore().empty());
 }
+
+/**
+ * @brief Ensures that key frames for many objects update correctly when the AnimationController runs them on a job
+ * system, and that completion callbacks still run in object name order on the updating thread.
+ */
+TEST_F(GivenAnAnimationControllerReady, WhenJobSystemSet_ThenKeyFramesForAllObjectsUpdateInParallel) {
+    /* Preparation */
+    JobSystem jobSystem(4);
+    animationController_.setJobSystem(&jobSystem);
+    vector<std::unique_ptr<TestObject>> objects;
+    vector<string> callbackOrder;
+    vector<string> expectedOrder;
+    vec3 desiredPosition(6.0f, 5.0f, 4.0f);
+    deltaTime = 2.0f;
+    for (int i = 0; i < 40; ++i) {
+        // Zero padded so the store's name ordering matches creation order
+        auto name = string("testObject") + (i < 10 ? "0" : "") + std::to_string(i);
+        objects.push_back(std::make_unique<TestObject>(name));
+        objects.back()->setPosition(vec3(0.0f));
+        auto keyFrame = AnimationController::createKeyFrameCb(UPDATE_POS, [&callbackOrder, name]() {
+            callbackOrder.push_back(name);
+        }, 1.0f);
+        keyFrame->pos.desired = desiredPosition;
+        animationController_.addKeyFrame(objects.back().get(), keyFrame);
+        expectedOrder.push_back(name);
+    }
+
+    /* Action */
+    animationController_.update();
+
+    /* Validation */
+    for (auto &object : objects) {
+        ASSERT_VEC_EQ(desiredPosition, object->getPosition());
+    }
+    ASSERT_TRUE(animationController_.getKeyFrameStore().empty());
+    ASSERT_EQ(expectedOrder, callbackOrder);
+}
+
+/**
+ * @brief Ensures key frames advance by the scaled delta time of the FrameContext they are handed, ignoring the
+ * deltaTime global, and stand still while the frame is paused.
+ */
+TEST_F(GivenAnAnimationControllerReady, WhenUpdatedWithFrameContext_ThenScaledDeltaTimeUsed) {
+    /* Preparation */
+    TestObject obj(DUMMY_OBJ_NAME);
+    vec3 desiredPosition(4.0f, 0.0f, 0.0f);
+    deltaTime = 100.0f;
+    // Two real seconds at half speed
+    auto frame = FrameContext().next(2.0, 0.5);
+    auto pausedFrame = frame.next(2.0, 0.0);
+    obj.setPosition(vec3(0.0f));
+    auto keyFrame = AnimationController::createKeyFrame(UPDATE_POS, 4.0f);
+    keyFrame->pos.desired = desiredPosition;
+    animationController_.addKeyFrame(&obj, keyFrame);
+
+    /* Action */
+    animationController_.update(frame);
+    auto scaledPosition = obj.getPosition();
+    animationController_.update(pausedFrame);
+
+    /* Validation */
+    ASSERT_VEC_EQ(vec3(1.0f, 0.0f, 0.0f), scaledPosition);
+    ASSERT_VEC_EQ(vec3(1.0f, 0.0f, 0.0f), obj.getPosition());
+    ASSERT_EQ(1, animationController_.getKeyFrameStore().at(DUMMY_OBJ_NAME).kQueue.size());
+    ASSERT_EQ(2u, pausedFrame.frameIndex);
+    ASSERT_DOUBLE_EQ(4.0, pausedFrame.realTime);
+    ASSERT_DOUBLE_EQ(1.0, pausedFrame.time);
+}
@@ -20,6 +20,7 @@ class DummyGfxController : public GfxController {
     GfxResult<uint> generateTexture(uint *textureId);
     GfxResult<uint> bindBuffer(uint bufferId);
     GfxResult<uint> sendBufferData(size_t size, void *data);
+    GfxResult<uint> sendBufferDataDynamic(size_t size, void *data);
     GfxResult<uint> sendTextureData(uint width, uint height, TexFormat format, void *data);
     GfxResult<uint> sendTextureData3D(int offsetx, int offsety, int index, uint width, uint height,
         TexFormat format, void *data);
@@ -46,6 +47,7 @@ class DummyGfxController : public GfxController {
     GfxResult<uint> disableVertexAttArray(uint layout);
     GfxResult<uint> drawTriangles(uint size);
     GfxResult<uint> drawTrianglesInstanced(uint size, uint count);
+    GfxResult<uint> drawTrianglesRange(uint size, uint first);
     GfxResult<uint> allocateTexture3D(TexFormat format, uint width, uint height, uint layers);
     void setBgColor(float r, float g, float b);
     void deleteVao(uint *vao);
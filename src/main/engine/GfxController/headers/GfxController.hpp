@@ -65,7 +65,8 @@ class TexVal {
 };
 
 enum class GfxCapability {
-    CULL_FACE
+    CULL_FACE,
+    DEPTH_TEST
 };
 
 enum class GfxClearMode {
@@ -110,6 +111,15 @@ class GfxController {
     virtual GfxResult<uint> generateTexture(uint *textureId) = 0;
     virtual GfxResult<uint> bindBuffer(uint bufferId) = 0;
     virtual GfxResult<uint> sendBufferData(size_t size, void *data) = 0;
+    /**
+     * @brief Same as sendBufferData, but hints that the buffer is rewritten every frame, such as a batch rebuilt on
+     * the CPU.
+     *
+     * @param size Size of the data array
+     * @param data The data array to write to the bound buffer, or nullptr to only allocate the storage
+     * @return GfxResult<uint> OK if successful; FAILURE otherwise
+     */
+    virtual GfxResult<uint> sendBufferDataDynamic(size_t size, void *data) = 0;
     virtual GfxResult<uint> sendTextureData(uint width, uint height, TexFormat format,
         void *data) = 0;
     virtual GfxResult<uint> sendTextureData3D(int offsetx, int offsety, int index, uint width, uint height,
@@ -171,6 +181,14 @@ class GfxController {
     virtual GfxResult<uint> disableVertexAttArray(uint layout) = 0;
     virtual GfxResult<uint> drawTriangles(uint size) = 0;
     virtual GfxResult<uint> drawTrianglesInstanced(uint size, uint count) = 0;
+    /**
+     * @brief Draws a range of the vertices in the bound VAO as triangles.
+     *
+     * @param size Number of vertices to draw.
+     * @param first Index of the first vertex to draw.
+     * @return GfxResult<uint> OK if succeeded, FAILURE if error occurred.
+     */
+    virtual GfxResult<uint> drawTrianglesRange(uint size, uint first) = 0;
     virtual GfxResult<uint> allocateTexture3D(TexFormat format, uint width, uint height, uint layers) = 0;
     /**
      * @brief Sets the background color of the window.
@@ -21,6 +21,7 @@ class MockGfxController : public GfxController {
     MOCK_METHOD(GfxResult<uint>, generateTexture, (uint *), (override));
     MOCK_METHOD(GfxResult<uint>, bindBuffer, (uint), (override));
     MOCK_METHOD(GfxResult<uint>, sendBufferData, (size_t, void *), (override));
+    MOCK_METHOD(GfxResult<uint>, sendBufferDataDynamic, (size_t, void *), (override));
     MOCK_METHOD(GfxResult<uint>, sendTextureData, (uint, uint, TexFormat, void *), (override));
     MOCK_METHOD(GfxResult<uint>, sendTextureData3D, (int, int, int, uint, uint, TexFormat, void *), (override));
     MOCK_METHOD(GfxResult<int>, getShaderVariable, (uint, const char *), (override));
@@ -45,6 +46,7 @@ class MockGfxController : public GfxController {
     MOCK_METHOD(GfxResult<uint>, disableVertexAttArray, (uint), (override));
     MOCK_METHOD(GfxResult<uint>, drawTriangles, (uint), (override));
     MOCK_METHOD(GfxResult<uint>, drawTrianglesInstanced, (uint, uint), (override));
+    MOCK_METHOD(GfxResult<uint>, drawTrianglesRange, (uint, uint), (override));
     MOCK_METHOD(GfxResult<uint>, allocateTexture3D, (TexFormat, uint, uint, uint), (override));
     MOCK_METHOD(void, clear, (GfxClearMode), (override));
     MOCK_METHOD(void, update, (), (override));
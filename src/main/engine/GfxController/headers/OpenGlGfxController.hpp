@@ -15,6 +15,9 @@
 #else
 #include <core/glad.h>
 #endif
+#include <climits>
+#include <map>
+#include <utility>
 #include <vector>
 #include <string>
 #include <GfxController.hpp>
@@ -23,15 +26,37 @@
 // Temporary until we get a logger, disables noisy OpenGL logs
 // #define VERBOSE_LOGS
 
+// How OpenGL errors are checked. Every glGetError call is a round trip to the driver that stalls command buffering.
+enum class GfxErrorMode {
+    IMMEDIATE,  // glGetError after every call, so the failing call returns FAILURE. For debugging.
+    DEFERRED  // Errors drained once per frame in update, or reported through debug output on a 4.3+ context
+};
+
+#ifdef GFX_DEBUG
+#define GFX_DEFAULT_ERROR_MODE GfxErrorMode::IMMEDIATE
+#else
+#define GFX_DEFAULT_ERROR_MODE GfxErrorMode::DEFERRED
+#endif  // GFX_DEBUG
+
+// Cached binding the controller has not set yet, so the next call always reaches the driver
+#define GFX_STATE_UNKNOWN UINT_MAX
+
+// Counters for the state cache, which skips calls that would set state OpenGL already has
+struct GfxStateCacheStats {
+    uint    hits = 0;  // Driver calls skipped because the state was already set
+    uint    misses = 0;  // Driver calls made because the state changed
+};
+
 class OpenGlGfxController : public GfxController {
  public:
-    OpenGlGfxController();
+    explicit OpenGlGfxController(GfxErrorMode errorMode = GFX_DEFAULT_ERROR_MODE);
     ~OpenGlGfxController();
     GfxResult<int> init();
     GfxResult<uint> generateBuffer(uint *bufferId);
     GfxResult<uint> generateTexture(uint *textureId);
     GfxResult<uint> bindBuffer(uint bufferId);
     GfxResult<uint> sendBufferData(size_t size, void *data);
+    GfxResult<uint> sendBufferDataDynamic(size_t size, void *data);
     GfxResult<uint> sendTextureData(uint width, uint height, TexFormat format, void *data);
     GfxResult<uint> sendTextureData3D(int offsetx, int offsety, int index, uint width, uint height, TexFormat format,
       void *data);
@@ -58,6 +83,7 @@ class OpenGlGfxController : public GfxController {
     GfxResult<uint> disableVertexAttArray(uint layout);
     GfxResult<uint> drawTriangles(uint size);
     GfxResult<uint> drawTrianglesInstanced(uint size, uint count);
+    GfxResult<uint> drawTrianglesRange(uint size, uint first);
     GfxResult<uint> allocateTexture3D(TexFormat format, uint width, uint height, uint layers);
     void setBgColor(float r, float g, float b);
     void deleteVao(uint *vao);
@@ -65,8 +91,34 @@ class OpenGlGfxController : public GfxController {
     void clear(GfxClearMode clearMode);
     void update();
     void updateOpenGl();
+    uint checkFrameErrors();
+    void setErrorMode(GfxErrorMode errorMode);
+    inline GfxErrorMode getErrorMode() const { return errorMode_; }
+    /**
+     * @brief Gets the state cache counters for the last finished frame, so hits is the number of driver calls saved.
+     */
+    inline GfxStateCacheStats getStateCacheStats() const { return lastFrameStateStats_; }
+    void invalidateStateCache();
 
  private:
+    /**
+     * @brief Counts a state cache lookup.
+     *
+     * @param hit Whether the cached state already matches the requested state.
+     * @return bool hit, so callers can skip the driver call.
+     */
+    inline bool isCached(bool hit) {
+        hit ? frameStateStats_.hits++ : frameStateStats_.misses++;
+        return hit;
+    }
+    void setGlCapability(GLenum capability, bool enabled);
+    /**
+     * @brief Checks the error raised by the OpenGL call just made. Only queries the driver in IMMEDIATE mode, in
+     * DEFERRED mode errors are left for checkFrameErrors.
+     *
+     * @return GLenum The error in IMMEDIATE mode, GL_NO_ERROR otherwise.
+     */
+    inline GLenum checkError() { return errorMode_ == GfxErrorMode::IMMEDIATE ? glGetError() : GL_NO_ERROR; }
     map<string, uint> programIdMap_;
 
     /* Objects tracked internally to free when closing */
@@ -74,4 +126,16 @@ class OpenGlGfxController : public GfxController {
     vector<uint> vboList_;
     vector<uint> textureIdList_;
     vector<float> bgColor_;
+    GfxErrorMode errorMode_;
+
+    /* Shadow of the OpenGL state, GFX_STATE_UNKNOWN until first set */
+    uint boundProgram_;
+    uint boundVao_;
+    uint boundBuffer_;
+    GLenum activeTextureUnit_;
+    map<std::pair<GLenum, GLenum>, uint> boundTextures_;  // (unit, target) -> texture. Missing entries are unknown.
+    uint polygonMode_;  // RenderMode value
+    map<GLenum, bool> capabilities_;  // Missing entries are unknown
+    GfxStateCacheStats frameStateStats_;
+    GfxStateCacheStats lastFrameStateStats_;
 };
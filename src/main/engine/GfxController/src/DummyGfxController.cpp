@@ -34,6 +34,11 @@ GfxResult<uint> DummyGfxController::sendBufferData(size_t size, void *data) {
     return GFX_OK(uint);
 }
 
+GfxResult<uint> DummyGfxController::sendBufferDataDynamic(size_t size, void *data) {
+    printf("GfxController::sendBufferDataDynamic: size %zu, data %p\n", size, data);
+    return GFX_OK(uint);
+}
+
 GfxResult<uint> DummyGfxController::sendTextureData(uint width, uint height, TexFormat format,
     void *data) {
     printf("GfxController::sendTextureData: width %u, height %u, format %d, data %p\n",
@@ -197,6 +202,12 @@ GfxResult<uint> DummyGfxController::drawTrianglesInstanced(uint size, uint count
     return GFX_OK(uint);
 }
 
+GfxResult<uint> DummyGfxController::drawTrianglesRange(uint size, uint first) {
+    printf("GfxController::drawTrianglesRange: size %d, first %d\n",
+        size, first);
+    return GFX_OK(uint);
+}
+
 GfxResult<uint> DummyGfxController::allocateTexture3D(TexFormat format, uint width, uint height, uint layers) {
     printf("GfxController::allocateTexture3D: format %d, width %u, height %u, layers %u\n",
         static_cast<std::underlying_type_t<TexFormat>>(format), width, height, layers);
@@ -27,7 +27,7 @@ GfxResult<uint> OpenGlGfxController::generateBuffer(uint *bufferId) {
     printf("OpenGlGfxController::generateBuffer: bufferId %p\n", bufferId);
 #endif
     glGenBuffers(1, bufferId);
-    auto error = glGetError();
+    auto error = checkError();
     if (error != GL_NO_ERROR) {
         fprintf(stderr, "OpenGlGfxController::generateBuffer: Error %d\n", error);
         return GFX_FAILURE(uint);
@@ -43,12 +43,15 @@ GfxResult<uint> OpenGlGfxController::generateBuffer(uint *bufferId) {
  * @return GfxResult<uint> OK if successful; FAILURE otherwise
  */
 GfxResult<uint> OpenGlGfxController::bindBuffer(uint bufferId) {
+    if (isCached(boundBuffer_ == bufferId)) return GFX_OK(uint);
     glBindBuffer(GL_ARRAY_BUFFER, bufferId);
-    auto error = glGetError();
+    auto error = checkError();
     if (error != GL_NO_ERROR) {
         fprintf(stderr, "OpenGlGfxController::bindBuffer: Error %d\n", error);
+        boundBuffer_ = GFX_STATE_UNKNOWN;
         return GFX_FAILURE(uint);
     }
+    boundBuffer_ = bufferId;
     return GFX_OK(uint);
 }
 
@@ -65,7 +68,7 @@ GfxResult<uint> OpenGlGfxController::sendBufferData(size_t size, void *data) {
     printf("OpenGlGfxController::sendBufferData: size %lu data %p\n", size, data);
 #endif
     glBufferData(GL_ARRAY_BUFFER, size, data, GL_STATIC_DRAW);
-    auto error = glGetError();
+    auto error = checkError();
     if (error != GL_NO_ERROR) {
         fprintf(stderr, "OpenGlGfxController::sendBufferData: Error %d\n", error);
         return GFX_FAILURE(uint);
@@ -73,6 +76,27 @@ GfxResult<uint> OpenGlGfxController::sendBufferData(size_t size, void *data) {
     return GFX_OK(uint);
 }
 
+/**
+ * @brief Sends data to the currently bound buffer with the GL_DYNAMIC_DRAW usage hint, for buffers that are
+ * rewritten every frame.
+ *
+ * @param size Size of the data array
+ * @param data The data array write to the OpenGL buffer, or nullptr to only allocate the storage
+ * @return GfxResult<uint> OK if successful; FAILURE otherwise
+ */
+GfxResult<uint> OpenGlGfxController::sendBufferDataDynamic(size_t size, void *data) {
+#ifdef VERBOSE_LOGS
+    printf("OpenGlGfxController::sendBufferDataDynamic: size %lu data %p\n", size, data);
+#endif
+    glBufferData(GL_ARRAY_BUFFER, size, data, GL_DYNAMIC_DRAW);
+    auto error = checkError();
+    if (error != GL_NO_ERROR) {
+        fprintf(stderr, "OpenGlGfxController::sendBufferDataDynamic: Error %d\n", error);
+        return GFX_FAILURE(uint);
+    }
+    return GFX_OK(uint);
+}
+
 /**
  * @brief Copies texture data to the currently bound texture buffer.
  *
@@ -101,7 +125,7 @@ GfxResult<uint> OpenGlGfxController::sendTextureData(uint width, uint height, Te
             return GFX_FAILURE(uint);
     }
     glTexImage2D(GL_TEXTURE_2D, 0, texFormat, width, height, 0, texFormat, GL_UNSIGNED_BYTE, data);
-    auto error = glGetError();
+    auto error = checkError();
     if (error != GL_NO_ERROR) {
         fprintf(stderr, "OpenGlGfxController::sendTextureData: Error %d\n", error);
         return GFX_FAILURE(uint);
@@ -122,7 +146,7 @@ GfxResult<uint> OpenGlGfxController::sendTextureData3D(int offsetx, int offsety,
         format == TexFormat::RGB ? GL_RGB : GL_RGBA,
         GL_UNSIGNED_BYTE,
         data);
-    auto error = glGetError();
+    auto error = checkError();
     if (error != GL_NO_ERROR) {
         fprintf(stderr, "OpenGlGfxController::sendTextureData3D: Error %d\n", error);
         return GFX_FAILURE(uint);
@@ -137,7 +161,7 @@ GfxResult<uint> OpenGlGfxController::sendTextureData3D(int offsetx, int offsety,
  */
 GfxResult<uint> OpenGlGfxController::generateMipMap() {
     glGenerateMipmap(GL_TEXTURE_2D);
-    auto error = glGetError();
+    auto error = checkError();
     if (error != GL_NO_ERROR) {
         fprintf(stderr, "OpenGlGfxController::generateMipMap: Error %d\n", error);
         return GFX_FAILURE(uint);
@@ -153,7 +177,7 @@ GfxResult<uint> OpenGlGfxController::generateMipMap() {
  */
 GfxResult<uint> OpenGlGfxController::generateTexture(uint *textureId) {
     glGenTextures(1, textureId);
-    auto error = glGetError();
+    auto error = checkError();
     if (error != GL_NO_ERROR) {
         fprintf(stderr, "OpenGlGfxController::generateTexture: Error: %d\n", error);
         return GFX_FAILURE(uint);
@@ -173,7 +197,7 @@ GfxResult<uint> OpenGlGfxController::allocateTexture3D(TexFormat format, uint wi
         format == TexFormat::RGB ? GL_RGB : GL_RGBA,  // format
         GL_UNSIGNED_BYTE,  // type
         nullptr);  // data - not required at allocation
-    auto error = glGetError();
+    auto error = checkError();
     if (error != GL_NO_ERROR) {
         fprintf(stderr, "OpenGlGfxController::allocateTexture3D: Error: %d\n", error);
         return GFX_FAILURE(uint);
@@ -293,21 +317,37 @@ GfxResult<int> OpenGlGfxController::getShaderVariable(uint programId, const char
  */
 void OpenGlGfxController::updateOpenGl() {
 #ifndef GFX_EMBEDDED
-    glEnable(GL_MULTISAMPLE);
+    setGlCapability(GL_MULTISAMPLE, true);
 #endif  // GFX_EMBEDDED
-    glEnable(GL_DEPTH_TEST);
-    glEnable(GL_CULL_FACE);
-    glEnable(GL_BLEND);
+    setGlCapability(GL_DEPTH_TEST, true);
+    setGlCapability(GL_CULL_FACE, true);
+    setGlCapability(GL_BLEND, true);
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
     glCullFace(GL_BACK);
     glDepthFunc(GL_LESS);
     glClearColor(bgColor_[0], bgColor_[1], bgColor_[2], 1.0f);
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-    auto error = glGetError();
-    if (error != GL_NO_ERROR) {
-        fprintf(stderr, "OpenGlGfxController::updateOpenGl: Error: %d\n", error);
-        return;
+}
+
+/**
+ * @brief Drains every error OpenGL recorded since the last check. In deferred mode this is the only glGetError call
+ * made during a frame, so the driver only has to flush once.
+ *
+ * @return uint Number of errors drained.
+ */
+uint OpenGlGfxController::checkFrameErrors() {
+    uint errorCount = 0;
+    GLenum firstError = GL_NO_ERROR;
+    // OpenGL keeps one flag per error type, so keep reading until every flag is cleared
+    for (auto error = glGetError(); error != GL_NO_ERROR; error = glGetError()) {
+        if (errorCount == 0) firstError = error;
+        errorCount++;
+    }
+    if (errorCount > 0) {
+        fprintf(stderr, "OpenGlGfxController::checkFrameErrors: %u error(s) since last frame, first Error %d\n",
+            errorCount, firstError);
     }
+    return errorCount;
 }
 
 /**
@@ -315,9 +355,65 @@ void OpenGlGfxController::updateOpenGl() {
  *
  */
 void OpenGlGfxController::update() {
+    checkFrameErrors();
+    lastFrameStateStats_ = frameStateStats_;
+    frameStateStats_ = GfxStateCacheStats();
     updateOpenGl();
 }
 
+/**
+ * @brief Forgets the cached OpenGL state, so the next call for each piece of state reaches the driver. Needed after
+ * anything outside of the controller changes OpenGL state.
+ */
+void OpenGlGfxController::invalidateStateCache() {
+    boundProgram_ = GFX_STATE_UNKNOWN;
+    boundVao_ = GFX_STATE_UNKNOWN;
+    boundBuffer_ = GFX_STATE_UNKNOWN;
+    activeTextureUnit_ = GFX_STATE_UNKNOWN;
+    boundTextures_.clear();
+    polygonMode_ = GFX_STATE_UNKNOWN;
+    capabilities_.clear();
+}
+
+/**
+ * @brief Enables or disables an OpenGL capability, skipping the call when it is already in that state.
+ *
+ * @param capability OpenGL capability to toggle.
+ * @param enabled Whether the capability should be enabled.
+ */
+void OpenGlGfxController::setGlCapability(GLenum capability, bool enabled) {
+    auto cached = capabilities_.find(capability);
+    if (isCached(cached != capabilities_.end() && cached->second == enabled)) return;
+    enabled ? glEnable(capability) : glDisable(capability);
+    capabilities_[capability] = enabled;
+}
+
+/**
+ * @brief Switches between checking for errors after every OpenGL call and checking once per frame.
+ *
+ * @param errorMode IMMEDIATE to check after every call, DEFERRED to check once per frame in update.
+ */
+void OpenGlGfxController::setErrorMode(GfxErrorMode errorMode) {
+    // Errors raised under the old mode are reported before the switch, so none are attributed to the wrong call
+    checkFrameErrors();
+    errorMode_ = errorMode;
+    printf("OpenGlGfxController::setErrorMode: Checking errors %s\n",
+        errorMode_ == GfxErrorMode::IMMEDIATE ? "after every call" : "once per frame");
+}
+
+#ifndef GFX_EMBEDDED
+/**
+ * @brief Receives debug output messages from the driver. Only errors are logged, performance and other notices are
+ * dropped to keep the logs quiet.
+ */
+static void APIENTRY onGlDebugMessage([[maybe_unused]] GLenum source, GLenum type, [[maybe_unused]] GLuint id,
+    [[maybe_unused]] GLenum severity, [[maybe_unused]] GLsizei length, const GLchar *message,
+    [[maybe_unused]] const void *userParam) {
+    if (type != GL_DEBUG_TYPE_ERROR) return;
+    fprintf(stderr, "OpenGlGfxController::onGlDebugMessage: %s\n", message);
+}
+#endif  // GFX_EMBEDDED
+
 /**
  * @brief Initialize the OpenGL context.
  *
@@ -338,6 +434,20 @@ GfxResult<int> OpenGlGfxController::init() {
 #endif  // GFX_EMBEDDED
     // Set pixel storage alignment mode for font loading
     glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+#ifndef GFX_EMBEDDED
+    // The bundled glad only loads glDebugMessageCallback from core OpenGL 4.3, not from the KHR_debug extension, so
+    // this needs a 4.3+ context. The 3.3 context GameInstance requests leaves it null and errors are drained once per
+    // frame instead. When present, errors are reported with a message at the call that raised them, without the
+    // sync point glGetError forces. Not synchronous, so the driver can keep buffering.
+    if (glDebugMessageCallback != nullptr) {
+        glEnable(GL_DEBUG_OUTPUT);
+        glDebugMessageCallback(onGlDebugMessage, nullptr);
+        printf("OpenGlGfxController::init: Using OpenGL 4.3 debug output error reporting\n");
+    }
+#endif  // GFX_EMBEDDED
+    // Clear anything raised while the context was being set up
+    checkFrameErrors();
+    invalidateStateCache();
     return GFX_OK(int);
 }
 
@@ -348,12 +458,15 @@ GfxResult<int> OpenGlGfxController::init() {
  * @return GfxResult<uint> OK if successful, FAILURE if error occurred
  */
 GfxResult<uint> OpenGlGfxController::setProgram(uint programId) {
+    if (isCached(boundProgram_ == programId)) return GFX_OK(uint);
     glUseProgram(programId);
-    auto error = glGetError();
+    auto error = checkError();
     if (error != GL_NO_ERROR) {
         fprintf(stderr, "OpenGlGfxController::setProgram: programId %d Error: %d\n", programId, error);
+        boundProgram_ = GFX_STATE_UNKNOWN;
         return GFX_FAILURE(uint);
     }
+    boundProgram_ = programId;
     return GFX_OK(uint);
 }
 
@@ -393,7 +506,7 @@ GfxResult<uint> OpenGlGfxController::sendFloatVector(uint variableId, size_t cou
                 static_cast<std::underlying_type_t<VectorType>>(vType));
             break;
     }
-    auto error = glGetError();
+    auto error = checkError();
     if (error != GL_NO_ERROR) {
         fprintf(stderr, "OpenGlGfxController::sendFloatVector: vType %d, Error: %d\n",
             static_cast<std::underlying_type_t<VectorType>>(vType), error);
@@ -413,6 +526,8 @@ GfxResult<uint> OpenGlGfxController::polygonRenderMode([[maybe_unused]] RenderMo
     #ifdef GFX_EMBEDDED
     return GFX_OK(uint);
     #else
+    auto modeValue = static_cast<uint>(mode);
+    if (isCached(polygonMode_ == modeValue)) return GFX_OK(uint);
     auto result = GFX_OK(uint);
     switch (mode) {
         case RenderMode::POINT:
@@ -430,13 +545,15 @@ GfxResult<uint> OpenGlGfxController::polygonRenderMode([[maybe_unused]] RenderMo
             result = GFX_FAILURE(uint);
             break;
     }
-    auto error = glGetError();
+    auto error = checkError();
     if (error != GL_NO_ERROR) {
         /// @todo When a logger is added, add OpenGL error log debugging
         fprintf(stderr, "OpenGlGfxController::polygonRenderMode: mode %d, Error: %d\n",
             static_cast<std::underlying_type_t<RenderMode>>(mode), error);
+        polygonMode_ = GFX_STATE_UNKNOWN;
         return GFX_FAILURE(uint);
     }
+    if (result.isOk()) polygonMode_ = modeValue;
     return result;
     #endif  // GFX_EMBEDDED
 }
@@ -480,14 +597,22 @@ GfxResult<uint> OpenGlGfxController::bindTexture(uint textureId, GfxTextureType
             break;
     }
     // Use texture unit zero - nothing fancy
-    glActiveTexture(GL_TEXTURE0);
+    if (!isCached(activeTextureUnit_ == GL_TEXTURE0)) {
+        glActiveTexture(GL_TEXTURE0);
+        activeTextureUnit_ = GL_TEXTURE0;
+    }
+    auto binding = std::make_pair(activeTextureUnit_, texType);
+    auto cached = boundTextures_.find(binding);
+    if (isCached(cached != boundTextures_.end() && cached->second == textureId)) return GFX_OK(uint);
     glBindTexture(texType, textureId);
-    auto error = glGetError();
+    auto error = checkError();
     if (error != GL_NO_ERROR) {
         /// @todo When a logger is added, add OpenGL error log debugging
         fprintf(stderr, "OpenGlGfxController::bindTexture: textureId %u, Error: %d\n", textureId, error);
+        boundTextures_.erase(binding);
         return GFX_FAILURE(uint);
     }
+    boundTextures_[binding] = textureId;
     return GFX_OK(uint);
 }
 
@@ -499,13 +624,16 @@ GfxResult<uint> OpenGlGfxController::bindTexture(uint textureId, GfxTextureType
  * @return GfxResult<uint> OK if succeeded, FAILURE if error occurred
  */
 GfxResult<uint> OpenGlGfxController::bindVao(uint vao) {
+    if (isCached(boundVao_ == vao)) return GFX_OK(uint);
     glBindVertexArray(vao);
-    auto error = glGetError();
+    auto error = checkError();
     if (error != GL_NO_ERROR) {
         /// @todo When a logger is added, add OpenGL error log debugging
         fprintf(stderr, "OpenGlGfxController::bindVao: vao %u, Error: %d\n", vao, error);
+        boundVao_ = GFX_STATE_UNKNOWN;
         return GFX_FAILURE(uint);
     }
+    boundVao_ = vao;
     return GFX_OK(uint);
 }
 
@@ -526,15 +654,19 @@ GfxResult<uint> OpenGlGfxController::setCapability(GfxCapability capability, boo
         case GfxCapability::CULL_FACE:
             capabilityId = GL_CULL_FACE;
             break;
+        case GfxCapability::DEPTH_TEST:
+            capabilityId = GL_DEPTH_TEST;
+            break;
         default:
             printf("OpenGlGfxController::setCapability: Unknown capability %d\n",
                 static_cast<int>(capability));
             return GFX_FAILURE(uint);
     }
-    enabled ? glEnable(capabilityId) : glDisable(capabilityId);
-    auto error = glGetError();
+    setGlCapability(capabilityId, enabled);
+    auto error = checkError();
     if (error != GL_NO_ERROR) {
         fprintf(stderr, "OpenGlGfxController::setCapability: Error %d\n", error);
+        capabilities_.erase(capabilityId);
         return GFX_FAILURE(uint);
     }
     return GFX_OK(uint);
@@ -548,7 +680,7 @@ GfxResult<uint> OpenGlGfxController::setCapability(GfxCapability capability, boo
  */
 GfxResult<uint> OpenGlGfxController::initVao(uint *vao) {
     glGenVertexArrays(1, vao);
-    auto error = glGetError();
+    auto error = checkError();
     if (error != GL_NO_ERROR) {
         fprintf(stderr, "OpenGlGfxController::initVao: Error %d\n", error);
         return GFX_FAILURE(uint);
@@ -568,12 +700,16 @@ GfxResult<uint> OpenGlGfxController::initVao(uint *vao) {
  */
 GfxResult<uint> OpenGlGfxController::deleteTextures(uint *tId) {
     glDeleteTextures(1, tId);
-    auto error = glGetError();
+    auto error = checkError();
     if (error != GL_NO_ERROR) {
         fprintf(stderr, "OpenGlGfxController::deleteTextures: Error %d\n", error);
         return GFX_FAILURE(uint);
     }
     textureIdList_.erase(std::remove(textureIdList_.begin(), textureIdList_.end(), *tId), textureIdList_.end());
+    // OpenGL rebinds zero wherever a deleted texture was bound
+    for (auto &boundTexture : boundTextures_) {
+        if (boundTexture.second == *tId) boundTexture.second = 0;
+    }
     return GFX_OK(uint);
 }
 
@@ -588,7 +724,8 @@ GfxResult<uint> OpenGlGfxController::updateBufferData(const vector<float> &verti
     glBindBuffer(GL_ARRAY_BUFFER, vbo);
     glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(float) * vertices.size(), &vertices[0]);
     glBindBuffer(GL_ARRAY_BUFFER, 0);
-    auto error = glGetError();
+    boundBuffer_ = 0;
+    auto error = checkError();
     if (error != GL_NO_ERROR) {
         fprintf(stderr, "OpenGlGfxController::updateBufferData: Error %d\n", error);
         return GFX_FAILURE(uint);
@@ -662,7 +799,7 @@ GfxResult<uint> OpenGlGfxController::setTexParam(TexParam param, TexVal val, Gfx
             break;
     }
     glTexParameteri(glTexType, glParam, glVal);
-    auto error = glGetError();
+    auto error = checkError();
     if (error != GL_NO_ERROR) {
         fprintf(stderr, "OpenGlGfxController::setTexParam: Error %d\n", error);
         return GFX_FAILURE(uint);
@@ -679,7 +816,7 @@ GfxResult<uint> OpenGlGfxController::enableVertexAttArray(uint layout, int count
         count * size,                    // stride
         offset);                         // array buffer offset
     glEnableVertexAttribArray(layout);
-    auto error = glGetError();
+    auto error = checkError();
     if (error != GL_NO_ERROR) {
         fprintf(stderr, "OpenGlGfxController::enableVertexAttArray: Error %d\n", error);
         return GFX_FAILURE(uint);
@@ -689,7 +826,7 @@ GfxResult<uint> OpenGlGfxController::enableVertexAttArray(uint layout, int count
 
 GfxResult<uint> OpenGlGfxController::setVertexAttDivisor(uint layout, uint divisor) {
     glVertexAttribDivisor(layout, divisor);
-    auto error = glGetError();
+    auto error = checkError();
     if (error != GL_NO_ERROR) {
         fprintf(stderr, "OpenGlGfxController::setVertexAttDivisor: Error %d\n", error);
         return GFX_FAILURE(uint);
@@ -705,7 +842,7 @@ GfxResult<uint> OpenGlGfxController::setVertexAttDivisor(uint layout, uint divis
  */
 GfxResult<uint> OpenGlGfxController::disableVertexAttArray(uint layout) {
     glDisableVertexAttribArray(layout);
-    auto error = glGetError();
+    auto error = checkError();
     if (error != GL_NO_ERROR) {
         fprintf(stderr, "OpenGlGfxController::disableVertexAttArray: Error %d\n", error);
         return GFX_FAILURE(uint);
@@ -721,7 +858,7 @@ GfxResult<uint> OpenGlGfxController::disableVertexAttArray(uint layout) {
  */
 GfxResult<uint> OpenGlGfxController::drawTriangles(uint size) {
     glDrawArrays(GL_TRIANGLES, 0, size);
-    auto error = glGetError();
+    auto error = checkError();
     if (error != GL_NO_ERROR) {
         fprintf(stderr, "OpenGlGfxController::drawTriangles: Error %d\n", error);
         return GFX_FAILURE(uint);
@@ -731,7 +868,7 @@ GfxResult<uint> OpenGlGfxController::drawTriangles(uint size) {
 
 GfxResult<uint> OpenGlGfxController::drawTrianglesInstanced(uint size, uint count) {
     glDrawArraysInstanced(GL_TRIANGLES, 0, size, count);
-    auto error = glGetError();
+    auto error = checkError();
     if (error != GL_NO_ERROR) {
         fprintf(stderr, "OpenGlGfxController::drawTrianglesInstanced: Error %d\n", error);
         return GFX_FAILURE(uint);
@@ -739,6 +876,16 @@ GfxResult<uint> OpenGlGfxController::drawTrianglesInstanced(uint size, uint coun
     return GFX_OK(uint);
 }
 
+GfxResult<uint> OpenGlGfxController::drawTrianglesRange(uint size, uint first) {
+    glDrawArrays(GL_TRIANGLES, first, size);
+    auto error = checkError();
+    if (error != GL_NO_ERROR) {
+        fprintf(stderr, "OpenGlGfxController::drawTrianglesRange: Error %d\n", error);
+        return GFX_FAILURE(uint);
+    }
+    return GFX_OK(uint);
+}
+
 /**
  * @brief Clears buffers in the OpenGL context. Common uses are COLOR buffers (framebuffer) or
  * DEPTH buffers.
@@ -769,12 +916,13 @@ void OpenGlGfxController::clear(GfxClearMode clearMode) {
  */
 void OpenGlGfxController::deleteBuffer(uint *bufferId) {
     glDeleteBuffers(1, bufferId);
-    auto error = glGetError();
+    auto error = checkError();
     if (error != GL_NO_ERROR) {
         fprintf(stderr, "OpenGlGfxController::deleteBuffer: Error %d\n", error);
     } else {
         // Remove the buffer from the vboList
         vboList_.erase(std::remove(vboList_.begin(), vboList_.end(), *bufferId), vboList_.end());
+        if (boundBuffer_ == *bufferId) boundBuffer_ = 0;
     }
 }
 
@@ -785,17 +933,21 @@ void OpenGlGfxController::deleteBuffer(uint *bufferId) {
  */
 void OpenGlGfxController::deleteVao(uint *vao) {
     glDeleteVertexArrays(1, vao);
-    auto error = glGetError();
+    auto error = checkError();
     if (error != GL_NO_ERROR) {
         fprintf(stderr, "OpenGlGfxController::deleteVao: Error %d\n", error);
     } else {
         // Remove the VAO from the vaoList
         vaoList_.erase(std::remove(vaoList_.begin(), vaoList_.end(), *vao), vaoList_.end());
+        if (boundVao_ == *vao) boundVao_ = 0;
     }
 }
 
-OpenGlGfxController::OpenGlGfxController() : bgColor_ { 0.2f, 0.2f, 0.4f } {
-    printf("OpenGlGfxController::OpenGlGfxController\n");
+OpenGlGfxController::OpenGlGfxController(GfxErrorMode errorMode) : bgColor_ { 0.2f, 0.2f, 0.4f },
+    errorMode_ { errorMode } {
+    invalidateStateCache();
+    printf("OpenGlGfxController::OpenGlGfxController: Checking errors %s\n",
+        errorMode_ == GfxErrorMode::IMMEDIATE ? "after every call" : "once per frame");
 }
 
 OpenGlGfxController::~OpenGlGfxController() {
@@ -0,0 +1,126 @@
+/**
+ * @file CollisionKernelBench.cpp
+ * @author Alec Jackson
+ * @brief Microbenchmark comparing the batched AABB kernel against ColliderObject::getCollisionRaw
+ * @version 0.1
+ * @date 2025
+ *
+ * Usage: bench_CollisionKernel [objectCount] [iterations]
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#include <chrono> //NOLINT
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include <CollisionKernel.hpp>
+#include <TestObject.hpp>
+
+#define BENCH_DEFAULT_OBJECTS 1024
+#define BENCH_DEFAULT_ITERATIONS 5
+
+// Runs func iterations times and returns the fastest run in milliseconds
+template <typename Func>
+static double bestOf(int iterations, Func func) {
+    double best = -1.0;
+    for (int i = 0; i < iterations; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        func();
+        double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        if (best < 0.0 || elapsed < best) best = elapsed;
+    }
+    return best;
+}
+
+int main(int argc, char **argv) {
+    uint objectCount = argc > 1 ? static_cast<uint>(atoi(argv[1])) : BENCH_DEFAULT_OBJECTS;
+    int iterations = argc > 2 ? atoi(argv[2]) : BENCH_DEFAULT_ITERATIONS;
+    if (objectCount == 0 || iterations <= 0) {
+        fprintf(stderr, "Usage: %s [objectCount] [iterations]\n", argv[0]);
+        return 1;
+    }
+
+    // Unit cubes scattered through a volume dense enough that a fair share of pairs overlap
+    auto cube = std::make_shared<Polygon>();
+    vector<float> cubeVertices = { -1.0f, -1.0f, -1.0f, 1.0f, 1.0f, 1.0f };
+    cube->modelMap["cube"] = std::make_shared<Model>(cubeVertices.size() / 3, cubeVertices);
+    std::mt19937 rng(42);
+    float extent = static_cast<float>(objectCount) / 16.0f;
+    std::uniform_real_distribution<float> position(-extent, extent);
+    std::uniform_real_distribution<float> scale(0.5f, 2.0f);
+    vector<std::unique_ptr<TestObject>> objects;
+    vector<vec3> positions;
+    for (uint i = 0; i < objectCount; ++i) {
+        auto object = std::make_unique<TestObject>(cube, "bench-" + std::to_string(i));
+        object->createCollider("bench");
+        object->setScale(scale(rng));
+        object->setPosition(vec3(position(rng), position(rng), position(rng)));
+        object->updateModelMatrices();
+        object->updateCollider();
+        positions.push_back(object->getPosition());
+        objects.push_back(std::move(object));
+    }
+    uint64_t pairCount = static_cast<uint64_t>(objectCount) * objectCount;
+    vector<uint8_t> rawMasks(pairCount);
+    vector<uint8_t> scalarMasks(pairCount);
+    vector<uint8_t> batchMasks(pairCount);
+
+    double rawMs = bestOf(iterations, [&]() {
+        for (uint i = 0; i < objectCount; ++i) {
+            auto row = rawMasks.data() + static_cast<uint64_t>(i) * objectCount;
+            for (uint j = 0; j < objectCount; ++j) {
+                row[j] = static_cast<uint8_t>(ColliderExt::getCollisionRaw(positions[i], objects[i].get(),
+                    positions[j], objects[j].get()));
+            }
+        }
+    });
+
+    // The kernel timings include building the boxes, the same work the physics controller does each collision stage
+    AabbBatch batch;
+    auto buildBoxes = [&]() {
+        batch.clear();
+        for (uint i = 0; i < objectCount; ++i) {
+            auto collider = objects[i]->getCollider();
+            auto tm = glm::translate(mat4(1.0f), positions[i]);
+            auto center = ColliderObject::createCenter(tm, collider->pScaleMatrix(), collider);
+            auto offset = vec3(ColliderObject::createOffset(tm, collider->pScaleMatrix(), center, collider));
+            batch.push(vec3(center) - offset, vec3(center) + offset);
+        }
+    };
+    auto runKernel = [&](decltype(aabbOverlapBatch) *kernel, vector<uint8_t> *masks) {
+        buildBoxes();
+        for (uint i = 0; i < objectCount; ++i) {
+            auto boxMin = vec3(batch.minX[i], batch.minY[i], batch.minZ[i]);
+            auto boxMax = vec3(batch.maxX[i], batch.maxY[i], batch.maxZ[i]);
+            kernel(boxMin, boxMax, batch, 0, objectCount, masks->data() + static_cast<uint64_t>(i) * objectCount);
+        }
+    };
+    double scalarMs = bestOf(iterations, [&]() { runKernel(aabbOverlapBatchScalar, &scalarMasks); });
+    double batchMs = bestOf(iterations, [&]() { runKernel(aabbOverlapBatch, &batchMasks); });
+
+    uint64_t mismatches = 0;
+    uint64_t fullMatches = 0;
+    for (uint64_t i = 0; i < pairCount; ++i) {
+        if (rawMasks[i] != batchMasks[i] || scalarMasks[i] != batchMasks[i]) mismatches++;
+        if (batchMasks[i] == ALL_MATCH) fullMatches++;
+    }
+
+    printf("bench_CollisionKernel: %u objects, %llu pairs, %llu colliding, best of %d\n", objectCount,
+        static_cast<unsigned long long>(pairCount), static_cast<unsigned long long>(fullMatches),  // NOLINT
+        iterations);
+    printf("%-24s %12s %12s %10s\n", "path", "total ms", "ns/pair", "speedup");
+    auto report = [&](const char *name, double ms) {
+        printf("%-24s %12.3f %12.3f %9.2fx\n", name, ms, (ms * 1e6) / pairCount, rawMs / ms);
+    };
+    report("getCollisionRaw", rawMs);
+    report("aabbOverlapBatchScalar", scalarMs);
+    report(PHYS_SIMD_WIDTH == 8 ? "aabbOverlapBatch (AVX)" :
+        PHYS_SIMD_WIDTH == 4 ? "aabbOverlapBatch (SSE2)" : "aabbOverlapBatch", batchMs);
+    // Pairs touching within float rounding of the tolerance can land on either side, anything more is a bug
+    printf("%llu pairs disagree with getCollisionRaw\n", static_cast<unsigned long long>(mismatches));  // NOLINT
+    return 0;
+}
@@ -0,0 +1,199 @@
+/**
+ * @file PhysicsStressBench.cpp
+ * @author Alec Jackson
+ * @brief Headless stress benchmark sweeping the PhysicsController over body and thread counts
+ * @version 0.1
+ * @date 2025
+ *
+ * Usage: bench_PhysicsStress [maxBodies] [steps] [outputPrefix]
+ *
+ * Body counts run in decades from 100 up to maxBodies, thread counts double from 1 up to hardware_concurrency. Each
+ * run writes a row to <outputPrefix>.csv and <outputPrefix>.json. The physics controller logs every body to stdout,
+ * so run with stdout redirected - progress is reported on stderr.
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#include <chrono> //NOLINT
+#include <thread> //NOLINT
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include <physics.hpp>
+#include <TestObject.hpp>
+
+#define BENCH_MIN_BODIES 100
+#define BENCH_DEFAULT_MAX_BODIES 100000
+#define BENCH_DEFAULT_STEPS 60
+#define BENCH_WARMUP_STEPS 5
+#define BENCH_DEFAULT_OUTPUT "physics_stress"
+// Average space given to each body, so every body count runs at the same density
+#define BENCH_VOLUME_PER_BODY 64.0f
+
+// Totals for one body count and thread count pair
+struct StressResult {
+    uint                bodies = 0;
+    uint                threads = 0;
+    uint                steps = 0;
+    double              stepsPerSec = 0.0;
+    PhysicsStageTiming  timing;  // Average per step
+    double              pairsTested = 0.0;  // Average per step
+    double              contactsFound = 0.0;
+    double              solverPasses = 0.0;
+    double              queueWaitMs = 0.0;
+    double              workerIdleMs = 0.0;
+};
+
+/**
+ * @brief Fills a controller with bodies and times a fixed number of updates.
+ * @param cube Polygon shared by every body.
+ * @param bodyCount Bodies to add.
+ * @param threads Worker threads for the controller's job system.
+ * @param steps Updates to time after the warm up.
+ * @return Averages for the timed updates.
+ */
+static StressResult runStress(std::shared_ptr<Polygon> cube, uint bodyCount, uint threads, uint steps) {
+    StressResult result;
+    result.bodies = bodyCount;
+    result.threads = threads;
+    result.steps = steps;
+
+    // Same seed for every run, so each thread count simulates the same scene
+    std::mt19937 rng(1234);
+    float extent = std::cbrt(bodyCount * BENCH_VOLUME_PER_BODY) * 0.5f;
+    std::uniform_real_distribution<float> position(-extent, extent);
+    std::uniform_real_distribution<float> speed(-4.0f, 4.0f);
+    vector<std::unique_ptr<TestObject>> objects;
+    objects.reserve(bodyCount);
+    auto physics = std::make_unique<PhysicsController>(threads);
+    for (uint i = 0; i < bodyCount; ++i) {
+        auto object = std::make_unique<TestObject>(cube, "stress-" + std::to_string(i));
+        object->createCollider("stress");
+        object->setPosition(vec3(position(rng), position(rng), position(rng)));
+        // Every fourth body falls, the rest drift so the broadphase keeps seeing new pairs
+        bool falls = (i % 4) == 0;
+        auto handle = physics->addSceneObject(object.get(), PhysicsParams { true, falls, 0.5f, 1.0f });
+        if (!falls) physics->setVelocity(handle, vec3(speed(rng), speed(rng), speed(rng)));
+        objects.push_back(std::move(object));
+    }
+
+    auto frame = FrameContext::fromDeltaTime(1.0 / 60.0);
+    for (uint i = 0; i < BENCH_WARMUP_STEPS; ++i) {
+        physics->update(frame);
+    }
+    double totalMs = 0.0;
+    for (uint i = 0; i < steps; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        physics->update(frame);
+        totalMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        auto stats = physics->getStats();
+        result.timing.positionMs += stats.timing.positionMs;
+        result.timing.collisionMs += stats.timing.collisionMs;
+        result.timing.finalizeMs += stats.timing.finalizeMs;
+        result.timing.solveMs += stats.timing.solveMs;
+        result.timing.submitMs += stats.timing.submitMs;
+        result.pairsTested += stats.pairsTested;
+        result.contactsFound += stats.contactsFound;
+        result.solverPasses += stats.solverPasses;
+        result.queueWaitMs += stats.queueWaitMs;
+        result.workerIdleMs += stats.workerIdleMs;
+    }
+    // The controller references the objects, so tear it down first
+    physics.reset();
+
+    result.stepsPerSec = totalMs > 0.0 ? steps * 1000.0 / totalMs : 0.0;
+    for (auto value : { &result.timing.positionMs, &result.timing.collisionMs, &result.timing.finalizeMs,
+        &result.timing.solveMs, &result.timing.submitMs, &result.pairsTested, &result.contactsFound,
+        &result.solverPasses, &result.queueWaitMs, &result.workerIdleMs }) {
+        *value /= steps;
+    }
+    return result;
+}
+
+static void writeCsv(FILE *file, const vector<StressResult> &results) {
+    fprintf(file, "bodies,threads,steps,steps_per_sec,position_ms,collision_ms,finalize_ms,solve_ms,submit_ms,"
+        "pairs_tested,contacts_found,solver_passes,queue_wait_ms,worker_idle_ms\n");
+    for (auto &r : results) {
+        fprintf(file, "%u,%u,%u,%.3f,%.4f,%.4f,%.4f,%.4f,%.4f,%.1f,%.1f,%.2f,%.4f,%.4f\n", r.bodies, r.threads,
+            r.steps, r.stepsPerSec, r.timing.positionMs, r.timing.collisionMs, r.timing.finalizeMs,
+            r.timing.solveMs, r.timing.submitMs, r.pairsTested, r.contactsFound, r.solverPasses, r.queueWaitMs,
+            r.workerIdleMs);
+    }
+}
+
+static void writeJson(FILE *file, const vector<StressResult> &results) {
+    fprintf(file, "[\n");
+    for (uint i = 0; i < results.size(); ++i) {
+        auto &r = results[i];
+        fprintf(file, "  {\"bodies\": %u, \"threads\": %u, \"steps\": %u, \"steps_per_sec\": %.3f, "
+            "\"position_ms\": %.4f, \"collision_ms\": %.4f, \"finalize_ms\": %.4f, \"solve_ms\": %.4f, "
+            "\"submit_ms\": %.4f, \"pairs_tested\": %.1f, \"contacts_found\": %.1f, \"solver_passes\": %.2f, "
+            "\"queue_wait_ms\": %.4f, \"worker_idle_ms\": %.4f}%s\n", r.bodies, r.threads, r.steps, r.stepsPerSec,
+            r.timing.positionMs, r.timing.collisionMs, r.timing.finalizeMs, r.timing.solveMs, r.timing.submitMs,
+            r.pairsTested, r.contactsFound, r.solverPasses, r.queueWaitMs, r.workerIdleMs,
+            i + 1 < results.size() ? "," : "");
+    }
+    fprintf(file, "]\n");
+}
+
+int main(int argc, char **argv) {
+    uint maxBodies = argc > 1 ? static_cast<uint>(atoi(argv[1])) : BENCH_DEFAULT_MAX_BODIES;
+    int steps = argc > 2 ? atoi(argv[2]) : BENCH_DEFAULT_STEPS;
+    string prefix = argc > 3 ? argv[3] : BENCH_DEFAULT_OUTPUT;
+    if (maxBodies < BENCH_MIN_BODIES || steps <= 0) {
+        fprintf(stderr, "Usage: %s [maxBodies >= %d] [steps] [outputPrefix]\n", argv[0], BENCH_MIN_BODIES);
+        return 1;
+    }
+
+    vector<uint> bodyCounts;
+    for (uint count = BENCH_MIN_BODIES; count <= maxBodies; count *= 10) {
+        bodyCounts.push_back(count);
+        if (count > maxBodies / 10) break;
+    }
+    if (bodyCounts.back() != maxBodies) bodyCounts.push_back(maxBodies);
+    uint maxThreads = std::min<uint>(std::max(std::thread::hardware_concurrency(), 1u), PHYS_MAX_THREADS);
+    vector<uint> threadCounts;
+    for (uint count = 1; count < maxThreads; count *= 2) {
+        threadCounts.push_back(count);
+    }
+    threadCounts.push_back(maxThreads);
+
+    auto cube = std::make_shared<Polygon>();
+    vector<float> cubeVertices = { -1.0f, -1.0f, -1.0f, 1.0f, 1.0f, 1.0f };
+    cube->modelMap["cube"] = std::make_shared<Model>(cubeVertices.size() / 3, cubeVertices);
+
+    vector<StressResult> results;
+    for (auto bodies : bodyCounts) {
+        for (auto threads : threadCounts) {
+            results.push_back(runStress(cube, bodies, threads, static_cast<uint>(steps)));
+            auto &r = results.back();
+            fprintf(stderr, "bench_PhysicsStress: %6u bodies %2u threads %10.2f steps/s (position %.3f, collision "
+                "%.3f, finalize %.3f, solve %.3f, submit %.3f ms)\n", r.bodies, r.threads, r.stepsPerSec,
+                r.timing.positionMs, r.timing.collisionMs, r.timing.finalizeMs, r.timing.solveMs,
+                r.timing.submitMs);
+        }
+    }
+
+    auto csvPath = prefix + ".csv";
+    auto jsonPath = prefix + ".json";
+    FILE *csv = fopen(csvPath.c_str(), "w");
+    FILE *json = fopen(jsonPath.c_str(), "w");
+    if (csv == nullptr || json == nullptr) {
+        fprintf(stderr, "bench_PhysicsStress: Unable to open %s or %s for writing\n", csvPath.c_str(),
+            jsonPath.c_str());
+        if (csv != nullptr) fclose(csv);
+        if (json != nullptr) fclose(json);
+        return 1;
+    }
+    writeCsv(csv, results);
+    writeJson(json, results);
+    fclose(csv);
+    fclose(json);
+    fprintf(stderr, "bench_PhysicsStress: Wrote %s and %s\n", csvPath.c_str(), jsonPath.c_str());
+    return 0;
+}
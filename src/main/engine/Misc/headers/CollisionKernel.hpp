@@ -0,0 +1,133 @@
+/**
+ * @file CollisionKernel.hpp
+ * @author Alec Jackson
+ * @brief Batched AABB overlap tests for the physics collision stage
+ * @version 0.1
+ * @date 2025
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <common.hpp>
+#include <ColliderObject.hpp>
+
+// Boxes must overlap by more than this on an axis to match, same tolerance as ColliderObject::getCollisionRaw
+#define PHYS_COLLISION_EPSILON 1e-4f
+// Returned by aabbSweep when the boxes never touch
+#define PHYS_SWEEP_MISS 2.0f
+
+// Instruction set used by aabbOverlapBatch, picked at compile time
+#if defined(__AVX__)
+#define PHYS_SIMD_AVX 1
+#define PHYS_SIMD_WIDTH 8
+#elif defined(__SSE2__) || defined(_M_X64)
+#define PHYS_SIMD_SSE2 1
+#define PHYS_SIMD_WIDTH 4
+#else
+#define PHYS_SIMD_WIDTH 1
+#endif
+
+/**
+ * @brief Axis aligned boxes stored as one array per bound component, so the batch kernel can load several boxes
+ * per instruction.
+ */
+struct AabbBatch {
+    inline void clear() {
+        minX.clear(); minY.clear(); minZ.clear();
+        maxX.clear(); maxY.clear(); maxZ.clear();
+    }
+    inline void push(const vec3 &minBound, const vec3 &maxBound) {
+        minX.push_back(minBound.x); minY.push_back(minBound.y); minZ.push_back(minBound.z);
+        maxX.push_back(maxBound.x); maxY.push_back(maxBound.y); maxZ.push_back(maxBound.z);
+    }
+    inline uint size() const { return static_cast<uint>(minX.size()); }
+    vector<float> minX, minY, minZ;
+    vector<float> maxX, maxY, maxZ;
+};
+
+/**
+ * @brief Tests a single pair of boxes.
+ * @return Match mask with X_MATCH, Y_MATCH and Z_MATCH set for every axis the boxes overlap on.
+ */
+inline int aabbOverlap(const vec3 &min1, const vec3 &max1, const vec3 &min2, const vec3 &max2) {
+    int matching = NO_MATCH;
+    for (int i = 0; i < 3; ++i) {
+        // Same form as the batch kernels, so every path rounds identically
+        if ((min1[i] + PHYS_COLLISION_EPSILON) < max2[i] && min2[i] < (max1[i] - PHYS_COLLISION_EPSILON)) {
+            matching |= (1 << i);
+        }
+    }
+    return matching;
+}
+
+/**
+ * @brief Tests one box against a range of boxes in a batch using the widest instruction set available.
+ * @param minBound Minimum corner of the box to test.
+ * @param maxBound Maximum corner of the box to test.
+ * @param batch Boxes to test against.
+ * @param begin First batch index to test.
+ * @param end One past the last batch index to test.
+ * @param masks Output match masks, one per tested box. masks[0] holds the result for batch index begin.
+ */
+void aabbOverlapBatch(const vec3 &minBound, const vec3 &maxBound, const AabbBatch &batch, uint begin, uint end,
+    uint8_t *masks);
+
+/**
+ * @brief Plain C++ version of aabbOverlapBatch. Used on targets without SIMD support and as a reference in tests.
+ */
+void aabbOverlapBatchScalar(const vec3 &minBound, const vec3 &maxBound, const AabbBatch &batch, uint begin,
+    uint end, uint8_t *masks);
+
+/**
+ * @brief Finds when a moving box first overlaps a stationary box by at least skin on every axis.
+ * @param center Center of the moving box at the start of its motion.
+ * @param offset Half extents of the moving box.
+ * @param motion Distance the moving box travels over the sweep.
+ * @param otherCenter Center of the stationary box.
+ * @param otherOffset Half extents of the stationary box.
+ * @param skin Overlap required on each axis before the boxes count as touching.
+ * @return Fraction of motion travelled at the first contact, in [0, 1]. Greater than 1 when the boxes never touch
+ * during the sweep.
+ */
+float aabbSweep(const vec3 &center, const vec3 &offset, const vec3 &motion, const vec3 &otherCenter,
+    const vec3 &otherOffset, float skin);
+
+/**
+ * @brief Finds how far the first box has to move on each axis to stop overlapping the second box. Matches
+ * ColliderObject::getEdgePointRaw without rebuilding any transform matrices.
+ * @param center1 Center of the first box.
+ * @param offset1 Half extents of the first box.
+ * @param center2 Center of the second box.
+ * @param offset2 Half extents of the second box.
+ * @param epSign Direction of the first box relative to the second box before they collided.
+ * @return Unsigned penetration depth on each axis.
+ */
+vec3 aabbEdgePoint(const vec3 &center1, const vec3 &offset1, const vec3 &center2, const vec3 &offset2,
+    const vec3 &epSign);
+
+/**
+ * @brief Finds how far the first box has to move to leave the second box along the line between their centers.
+ * Matches ColliderObject::getEdgePointPosInf for boxes that are not backed by a ColliderObject.
+ * @param center1 Center of the first box.
+ * @param offset1 Half extents of the first box.
+ * @param center2 Center of the second box.
+ * @param offset2 Half extents of the second box.
+ * @return Signed push for the first box. Zero when the centers are the same.
+ */
+vec3 aabbEdgePointPosInf(const vec3 &center1, const vec3 &offset1, const vec3 &center2, const vec3 &offset2);
+
+/**
+ * @brief Separating axis test between a box and a triangle (Akenine-Moller). Touching counts as overlapping.
+ * @param center Center of the box.
+ * @param offset Half extents of the box.
+ * @param v0 First corner of the triangle.
+ * @param v1 Second corner of the triangle.
+ * @param v2 Third corner of the triangle.
+ * @return true when the box and triangle overlap.
+ */
+bool aabbTriangleOverlap(const vec3 &center, const vec3 &offset, const vec3 &v0, const vec3 &v1, const vec3 &v2);
@@ -0,0 +1,53 @@
+/**
+ * @file FrameContext.hpp
+ * @author Alec Jackson
+ * @brief Per-frame timing handed explicitly to every subsystem updated by the GameInstance
+ * @version 0.1
+ * @date 2025
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @brief Timing for one frame. Built once per frame by the GameInstance and passed by value or const reference, so
+ * subsystems running on other threads never read time that is being written underneath them.
+ */
+struct FrameContext {
+    uint64_t    frameIndex = 0;  // Frames finished before this one
+    double      realDeltaTime = 0.0;  // Wall clock seconds the last frame took
+    double      deltaTime = 0.0;  // realDeltaTime scaled by the time scale. 0 while paused.
+    double      fixedDeltaTime = 0.0;  // Step of fixed rate subsystems, 0 when everything steps once per frame
+    double      time = 0.0;  // Scaled seconds since the first frame
+    double      realTime = 0.0;  // Wall clock seconds since the first frame
+
+    /**
+     * @brief Builds the context for the frame after this one.
+     * @param frameRealDeltaTime Wall clock seconds this frame took.
+     * @param timeScale Multiplier applied to frameRealDeltaTime. 0 pauses scaled time.
+     * @param frameFixedDeltaTime Step of fixed rate subsystems for the next frame.
+     * @return Context for the next frame.
+     */
+    inline FrameContext next(double frameRealDeltaTime, double timeScale, double frameFixedDeltaTime = 0.0) const {
+        FrameContext frame;
+        frame.frameIndex = frameIndex + 1;
+        frame.realDeltaTime = frameRealDeltaTime;
+        frame.deltaTime = frameRealDeltaTime * timeScale;
+        frame.fixedDeltaTime = frameFixedDeltaTime;
+        frame.time = time + frame.deltaTime;
+        frame.realTime = realTime + frameRealDeltaTime;
+        return frame;
+    }
+    /**
+     * @brief Builds an unscaled context for a single frame, for callers that only have a frame time.
+     * @param frameDeltaTime Seconds the frame took.
+     * @return Context with both delta times set to frameDeltaTime.
+     */
+    static inline FrameContext fromDeltaTime(double frameDeltaTime) {
+        return FrameContext().next(frameDeltaTime, 1.0);
+    }
+};
@@ -32,6 +32,7 @@
 #include <TileObject.hpp>
 #include <config.hpp>
 #include <physics.hpp>
+#include <FrameContext.hpp>
 #include <AnimationController.hpp>
 #include <GameScene.hpp>
 #include <InputController.hpp>
@@ -42,6 +43,7 @@
 // Number of samples to use for anti-aliasing
 #define DEFAULT_AASAMPLES 0
 
+// Deprecated - real time of the last frame, mirrored from the FrameContext. Use getFrameContext instead.
 extern double deltaTime;
 
 /*
@@ -81,6 +83,10 @@ class GameInstance {
     mutex inputLock_;
     mutex progressLock_;
     mutex cameraLock_;
+    mutex frameLock_;  // Guards frame_, timeScale_ and paused_, which game threads may read or change
+    FrameContext frame_;  // Timing handed to the subsystems on the next update
+    double timeScale_ = 1.0;
+    bool paused_ = false;
     std::condition_variable inputCv_;
     std::condition_variable progressCv_;
     queue<std::function<void(void)>> protectedGfxReqs_;
@@ -161,7 +167,8 @@ class GameInstance {
     template<typename T>
     inline T *getCamera(string cameraName) { return dynamic_cast<T*>(getCamera(cameraName)); }
     int removeSceneObject(string objectName);
-    /* NOTE - getCollision functions are for convenience and will be deprecated with the physics controller */
+    /* NOTE - getCollision functions are for convenience and will be deprecated with the physics controller. Prefer
+     * PhysicsController::subscribe, which reports every contact once per step without polling pairs. */
     int getCollision(SceneObject *object1, SceneObject *object2);
     void setLuminance(float luminanceValue);
     void setDirectionalLight(vec3 directionalLight);
@@ -171,6 +178,23 @@ class GameInstance {
      * are controllers that must be updated from the main thread.
      */
     int update();
+    /**
+     * @brief Fetches the timing of the frame the next update call will run with. Safe to call from any thread.
+     * @return Copy of the current FrameContext.
+     */
+    FrameContext getFrameContext();
+    /**
+     * @brief Scales the delta time handed to physics and animations. Real time is never scaled.
+     * @param timeScale Multiplier for each frame's delta time. 1 runs at normal speed, 0.5 at half speed.
+     */
+    void setTimeScale(double timeScale);
+    double getTimeScale();
+    /**
+     * @brief Pauses or resumes scaled time. While paused physics and animations are handed a delta time of 0, while
+     * rendering and input carry on.
+     */
+    void setPaused(bool paused);
+    bool isPaused();
     /**
      * @brief Fetches input from the internal input queue. Functions blocks until an input event is received.
      * @return GameInput value pressed from either a controller or keyboard.
@@ -14,6 +14,10 @@
 #include <vector>
 #include <SceneObject.hpp>
 #include <CameraObject.hpp>
+#include <GameObject.hpp>
+#include <GameObject2D.hpp>
+#include <RenderQueue.hpp>
+#include <SpriteBatch.hpp>
 
 class GameScene {
  public:
@@ -41,6 +45,13 @@ class GameScene {
     std::map<std::string, std::shared_ptr<SceneObject>> sceneObjects_;
     // Render priority to list of scene objects
     std::map<uint, std::vector<std::shared_ptr<SceneObject>>> renderPriorityMap_;
+    // Draw packets for the frame being rendered, rebuilt every update
+    RenderQueue renderQueue_;
+    // GameObjects of the instanced draw being built, kept to avoid allocating every frame
+    std::vector<GameObject *> instanceBatch_;
+    // Sprites and UI elements of the batched draw being built, and the buffers they are drawn from
+    std::vector<GameObject2D *> spriteBatchObjects_;
+    SpriteBatch spriteBatch_;
     vec3 directionalLight_ = vec3(-100, 100, 100);
     std::mutex sceneLock_;
 };
@@ -0,0 +1,136 @@
+/**
+ * @file JobSystem.hpp
+ * @author Alec Jackson
+ * @brief Engine wide work-stealing job scheduler shared by physics, animation and asset loading
+ * @version 0.1
+ * @date 2025
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#pragma once
+
+#include <vector>
+#include <deque>
+#include <memory>
+#include <functional>
+#include <mutex> //NOLINT
+#include <thread> //NOLINT
+#include <condition_variable> //NOLINT
+#include <atomic>
+#include <chrono> //NOLINT
+#include <common.hpp>
+
+#define JOB_MAX_THREADS 256
+#define JOB_FUNC std::function<void(void)>
+#define JOB_RANGE_FUNC std::function<void(uint, uint)>
+
+/**
+ * @brief A single unit of work. Jobs only become runnable once every job they depend on has completed.
+ */
+struct Job {
+    JOB_FUNC func;
+    std::atomic<int> pendingDependencies { 1 };  // Starts with a guard count released on submit
+    std::atomic<bool> complete { false };
+    std::chrono::steady_clock::time_point queuedAt;  // When the job became runnable, for JobSystemStats::queueWaitMs
+    std::atomic<int> queueIndex { -1 };  // Worker queue holding the job while it is runnable, -1 otherwise
+    std::mutex lock;
+    vector<std::shared_ptr<Job>> continuations;  // Jobs waiting on this one
+    vector<std::shared_ptr<Job>> dependencies;  // Incomplete jobs this one waits on, dropped once it runs
+};
+
+typedef std::shared_ptr<Job> JobHandle;
+
+// Running totals since the job system was created. Subtract two snapshots to measure a span of work.
+struct JobSystemStats {
+    uint64_t    jobsRun = 0;
+    double      queueWaitMs = 0.0;  // Time runnable jobs spent queued before a thread picked them up
+    double      workerIdleMs = 0.0;  // Time worker threads spent asleep waiting for work
+};
+
+/**
+ * @brief Work-stealing scheduler. Each worker owns a deque - workers pop their own newest work first and steal the
+ * oldest work from other workers when they run dry. Threads that wait on a job help run the queued jobs it depends on
+ * instead of blocking, so waiting from inside a job does not starve the pool. Unrelated jobs are left alone, so a
+ * thread waiting while holding a lock never picks up a job that takes the same lock.
+ */
+class JobSystem {
+ public:
+    /**
+     * @brief Creates a job system with a given number of worker threads.
+     * @param threadNum Number of worker threads. With zero workers, jobs run on whichever thread waits on them.
+     */
+    explicit JobSystem(uint threadNum);
+    ~JobSystem();
+    /**
+     * @brief Queues a job to run once all of its dependencies have completed.
+     * @param func Work to run.
+     * @param dependencies Jobs that must complete before this job starts.
+     * @return JobHandle that can be waited on or used as a dependency.
+     */
+    JobHandle submit(JOB_FUNC func, const vector<JobHandle> &dependencies = {});
+    /**
+     * @brief Splits [0, count) into contiguous ranges and runs func on each range in parallel.
+     * @param count Number of items to process.
+     * @param batchSize Items per range. Zero picks count / threads so each worker gets one range.
+     * @param func Called with the [begin, end) range to process.
+     * @param dependencies Jobs that must complete before any range starts.
+     * @return JobHandle that completes when every range has completed.
+     */
+    JobHandle parallelFor(uint count, uint batchSize, JOB_RANGE_FUNC func,
+        const vector<JobHandle> &dependencies = {});
+    /**
+     * @brief Blocks until a job completes. The calling thread runs the job and the queued jobs it depends on, directly
+     * or through other jobs, while it waits.
+     * @param job Job to wait on. Empty handles return immediately.
+     */
+    void wait(const JobHandle &job);
+    static inline bool isComplete(const JobHandle &job) { return !job || job->complete; }
+    inline uint threadCount() { return threadNum_; }
+    /**
+     * @brief Takes a snapshot of the job system counters. The counters are relaxed atomics, so this is safe to call
+     * from any thread at any time, and the numbers may lag slightly behind jobs that are finishing right now.
+     * @return Totals since the job system was created.
+     */
+    JobSystemStats getStats() const;
+    static uint getDefaultThreadSize();
+
+ private:
+    struct WorkerQueue {
+        std::mutex lock;
+        std::deque<JobHandle> jobs;
+    };
+    void workerLoop(uint index);
+    void schedule(const JobHandle &job);
+    void execute(const JobHandle &job);
+    JobHandle findJob();
+    /**
+     * @brief Collects a job and every incomplete job it depends on, directly or through other jobs.
+     * @param job Job being waited on.
+     * @param chain Output list of the jobs in the chain.
+     */
+    void collectChain(const JobHandle &job, vector<JobHandle> *chain);
+    /**
+     * @brief Takes a queued job of a dependency chain out of its queue. Completed jobs are dropped from the chain, and
+     * only the queue each remaining job sits in is searched.
+     * @param chain Chain built by collectChain.
+     * @return A job from the chain, or an empty handle when none of them are queued.
+     */
+    JobHandle findJobFor(vector<JobHandle> *chain);
+    int currentQueue();
+
+    uint threadNum_;
+    std::atomic<bool> shutdown_ { false };
+    std::atomic<int> pendingJobs_ { 0 };
+    std::atomic<uint64_t> scheduledJobs_ { 0 };  // Bumped whenever a job becomes runnable, wakes waiting threads
+    std::atomic<uint> nextQueue_ { 0 };
+    std::atomic<uint64_t> jobsRun_ { 0 };
+    std::atomic<uint64_t> queueWaitNs_ { 0 };
+    std::atomic<uint64_t> workerIdleNs_ { 0 };
+    vector<std::unique_ptr<WorkerQueue>> queues_;
+    vector<std::thread> threads_;
+    std::mutex sleepLock_;
+    std::condition_variable workAvailableSignal_;
+    std::condition_variable jobCompletedSignal_;
+};
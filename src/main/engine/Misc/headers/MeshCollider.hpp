@@ -0,0 +1,95 @@
+/**
+ * @file MeshCollider.hpp
+ * @author Alec Jackson
+ * @brief Static triangle mesh collider stored in a bounding volume hierarchy
+ * @version 0.1
+ * @date 2025
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include <common.hpp>
+#include <Polygon.hpp>
+
+// Triangles a leaf may hold before the build always tries to split it
+#define MESH_BVH_LEAF_SIZE 4
+// Leaves are never split past this size, even when the surface area heuristic says splitting does not pay off
+#define MESH_BVH_MAX_LEAF_SIZE 16
+// Buckets the surface area heuristic sorts triangle centroids into when looking for a split
+#define MESH_BVH_BINS 12
+// Deepest tree the traversal stack can hold
+#define MESH_BVH_MAX_DEPTH 64
+
+/**
+ * @brief A single node of the flattened hierarchy. Nodes are stored depth first, so the first child of an interior
+ * node always directly follows it.
+ */
+struct MeshBvhNode {
+    vec3    minBound;
+    uint    first;  // Leaf: first triangle of the leaf. Interior: index of the second child.
+    vec3    maxBound;
+    uint    count;  // Triangles in the leaf, 0 for interior nodes
+};
+
+/**
+ * @brief Triangle soup built from model vertices, with a bounding volume hierarchy built using the surface area
+ * heuristic. Everything is in model space - the physics controller maps its queries through the owning object's
+ * position and scale. Immutable once built, so one mesh can be shared between any number of bodies and threads.
+ */
+class MeshCollider {
+ public:
+    /**
+     * @brief Builds the hierarchy for a list of triangles.
+     * @param vertices Flat x, y, z list with three vertices per triangle, as stored in Model::vertices. Trailing
+     * values that do not make up a full triangle are ignored.
+     */
+    explicit MeshCollider(const vector<float> &vertices);
+    /**
+     * @brief Builds a single mesh from every model in a polygon.
+     * @param polygon Polygon to read the model vertices from.
+     * @return The new mesh.
+     */
+    static std::shared_ptr<MeshCollider> fromPolygon(const Polygon &polygon);
+    /**
+     * @brief Collects every triangle whose bounds overlap a box. Read only, so safe to call from any thread.
+     * @param minBound Minimum corner of the box in model space.
+     * @param maxBound Maximum corner of the box in model space.
+     * @param triangles Output for the triangle indices. Cleared first.
+     */
+    void query(const vec3 &minBound, const vec3 &maxBound, vector<uint> *triangles) const;
+    /**
+     * @brief Finds the first triangle hit by a segment. Both faces of every triangle are solid.
+     * @param origin Start of the segment in model space.
+     * @param motion Segment from origin to its end. Does not need to be normalized.
+     * @param fraction In: furthest fraction of motion to consider. Out: fraction of motion at the hit, when there
+     * is a hit closer than the value passed in.
+     * @param triangle Output for the triangle hit.
+     * @return true when a triangle was hit before fraction.
+     */
+    bool raycast(const vec3 &origin, const vec3 &motion, float *fraction, uint *triangle) const;
+    inline const vec3 &vertex(uint triangle, uint corner) const { return vertices_[triangle * 3 + corner]; }
+    inline uint triangleCount() const { return static_cast<uint>(vertices_.size() / 3); }
+    inline const vector<MeshBvhNode> &nodes() const { return nodes_; }
+
+ private:
+    /**
+     * @brief Builds the subtree for a range of the triangle order and appends its nodes depth first.
+     * @param begin First entry of order in the subtree.
+     * @param end One past the last entry of order in the subtree.
+     * @param depth Depth of the subtree root, used to cap the tree at MESH_BVH_MAX_DEPTH.
+     */
+    void build(uint begin, uint end, uint depth);
+    vector<vec3> vertices_;  // Three per triangle, reordered so every leaf covers a contiguous range
+    vector<MeshBvhNode> nodes_;
+    // Build scratch, released once the hierarchy is finished
+    vector<uint> order_;
+    vector<vec3> triMin_;
+    vector<vec3> triMax_;
+    vector<vec3> centroids_;
+};
@@ -0,0 +1,156 @@
+/**
+ * @file PhysicsBodyStore.hpp
+ * @author Alec Jackson
+ * @brief Structure of arrays storage for physics body state, addressed through stable integer handles
+ * @version 0.1
+ * @date 2025
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include <climits>
+#include <common.hpp>
+#include <SceneObject.hpp>
+#include <ColliderExt.hpp>
+#include <MeshCollider.hpp>
+
+typedef uint32_t PhysicsHandle;
+
+#define PHYS_INVALID_HANDLE UINT32_MAX
+#define PHYS_INVALID_INDEX UINT_MAX
+// Handles pack a slot in the low bits and a generation in the high bits, so stale handles are rejected
+#define PHYS_HANDLE_SLOT_BITS 24
+#define PHYS_HANDLE_SLOT_MASK ((1u << PHYS_HANDLE_SLOT_BITS) - 1)
+#define PHYS_HANDLE_SLOT(handle) ((handle) & PHYS_HANDLE_SLOT_MASK)
+#define PHYS_HANDLE_GENERATION(handle) ((handle) >> PHYS_HANDLE_SLOT_BITS)
+
+/**
+ * @brief A contact between a body and one of its broadphase candidates. Kept across steps for as long as the pair stays
+ * in the broadphase, so a contact that keeps touching reuses what was learned about it the step before.
+ */
+struct PhysicsContactCache {
+    PhysicsHandle   other;
+    uint            otherIndex;  // Dense index of other, refreshed every COLLISION stage
+    vec3            normal;  // Axis the body was pushed out along, pointing away from other
+    float           penetration;  // Overlap along normal when the contact solver started
+    float           accumulated;  // Distance the contact solver moved the body along normal
+    uint8_t         touching;  // The pair collided during the most recent COLLISION stage
+};
+
+/**
+ * @brief Contiguous storage for every body in the physics controller. Each field lives in its own array so the
+ * pipeline stages walk memory linearly. Bodies are packed into [0, size()) - removing a body moves the last body into
+ * its slot, so dense indices are only valid until the next add or remove. Handles stay valid for the lifetime of the
+ * body and are translated to dense indices with indexOf. Bodies are awake when added, and only awake bodies are
+ * listed in active().
+ */
+class PhysicsBodyStore {
+ public:
+    /**
+     * @brief Adds a body to the end of the store.
+     * @param target SceneObject driven by the body.
+     * @param collider Collider attached to the target, or nullptr when the target has no collider.
+     * @return Handle for the new body.
+     */
+    PhysicsHandle add(SceneObject *target, ColliderExt *collider);
+    /**
+     * @brief Works out the handle a later add will return, without changing the store.
+     * @param ahead Number of adds that will run before the add to preview, with no removes in between.
+     * @return Handle the (ahead + 1)th add from now will return.
+     */
+    inline PhysicsHandle peekHandle(uint ahead) const {
+        // add takes free slots from the back before it grows the slot list, and new slots start at generation 0
+        if (ahead < freeSlots_.size()) {
+            auto slot = freeSlots_[freeSlots_.size() - 1 - ahead];
+            return (slots_[slot].generation << PHYS_HANDLE_SLOT_BITS) | slot;
+        }
+        return static_cast<PhysicsHandle>(slots_.size() + ahead - freeSlots_.size());
+    }
+    /**
+     * @brief Removes a body from the store. The last body is moved into the removed body's slot.
+     * @param handle Handle of the body to remove.
+     * @return true when the body existed and was removed, false otherwise.
+     */
+    bool remove(PhysicsHandle handle);
+    /**
+     * @brief Translates a handle into the body's current dense index.
+     * @param handle Handle to look up.
+     * @return Dense index of the body, or PHYS_INVALID_INDEX when the handle does not refer to a live body.
+     */
+    inline uint indexOf(PhysicsHandle handle) const {
+        auto slot = PHYS_HANDLE_SLOT(handle);
+        if (slot >= slots_.size() || slots_[slot].generation != PHYS_HANDLE_GENERATION(handle)) {
+            return PHYS_INVALID_INDEX;
+        }
+        return slots_[slot].index;
+    }
+    inline PhysicsHandle handleOf(uint index) const { return handles_[index]; }
+    inline uint size() const { return static_cast<uint>(target.size()); }
+    inline bool empty() const { return target.empty(); }
+    /**
+     * @brief Adds a sleeping body back to the active list. Does nothing when the body is already awake.
+     * @param index Dense index of the body to wake.
+     */
+    void wake(uint index);
+    /**
+     * @brief Removes a body from the active list. Does nothing when the body is already asleep.
+     * @param index Dense index of the body to put to sleep.
+     */
+    void sleep(uint index);
+    inline bool asleep(uint index) const { return activeSlot_[index] == PHYS_INVALID_INDEX; }
+    // Dense indices of every awake body, in no particular order
+    inline const vector<uint> &active() const { return active_; }
+    inline uint activeCount() const { return static_cast<uint>(active_.size()); }
+    // Bumped whenever the set of sleeping bodies or their dense indices change
+    inline uint sleepVersion() const { return sleepVersion_; }
+
+    // Per body state, indexed by dense index
+    vector<SceneObject *>   target;
+    vector<ColliderExt *>   collider;
+    vector<vec3>            position;  // Reference position the motion formula is applied to
+    vector<vec3>            prevPos;  // Simulated position before the last POSITION stage
+    vector<vec3>            stepPos;  // Simulated position the pipeline stages work on
+    vector<vec3>            renderPos;  // Position last published to the target
+    vector<vec3>            positionDelta;
+    vector<vec3>            velocity;
+    vector<vec3>            velocityDelta;
+    vector<vec3>            acceleration;
+    vector<vec3>            boundsMin;  // Broadphase query bounds, refreshed before each collision stage
+    vector<vec3>            boundsMax;
+    vector<vec3>            colliderCenter;  // Collider center relative to the target position
+    vector<vec3>            colliderOffset;  // Collider half extents
+    vector<vec3>            scale;  // Target scale, copied from the target when the update starts
+    vector<double>          runningTime;
+    vector<double>          gravTime;
+    vector<float>           elasticity;
+    vector<float>           mass;
+    vector<uint8_t>         isKinematic;
+    vector<uint8_t>         obeyGravity;
+    vector<uint8_t>         hasCollision;
+    vector<uint8_t>         continuous;  // Swept collision checks enabled
+    vector<std::shared_ptr<const MeshCollider>> mesh;  // Triangles tested in place of the collider box
+    vector<uint>            sleepFrames;  // Consecutive steps the body has spent at rest
+    vector<vector<PhysicsContactCache>> contactCache;  // Contacts found by this body, in broadphase candidate order
+
+ private:
+    struct HandleSlot {
+        uint index = PHYS_INVALID_INDEX;  // Dense index of the body using this slot
+        uint generation = 0;  // Bumped whenever the slot is freed
+    };
+    /**
+     * @brief Drops an awake body from the active list by moving the last active body into its place.
+     */
+    void removeActive(uint index);
+    vector<PhysicsHandle> handles_;  // Dense index to handle
+    vector<HandleSlot> slots_;
+    vector<uint> freeSlots_;
+    vector<uint> active_;  // Dense indices of awake bodies
+    vector<uint> activeSlot_;  // Dense index to position in active_, PHYS_INVALID_INDEX while asleep
+    uint sleepVersion_ = 0;
+};
@@ -0,0 +1,87 @@
+/**
+ * @file PhysicsBroadphase.hpp
+ * @author Alec Jackson
+ * @brief Spatial hash broadphase used to cut down the pairs checked in the physics collision stage
+ * @version 0.1
+ * @date 2025
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#pragma once
+
+#include <vector>
+#include <unordered_map>
+#include <functional>
+#include <cstdint>
+#include <common.hpp>
+
+// Default edge length of a single spatial hash cell in world units
+#define PHYS_BROADPHASE_CELL_SIZE 4.0f
+// Objects spanning more cells than this are kept in an oversized list that every query sees
+#define PHYS_BROADPHASE_MAX_CELLS 64
+// Padding added to query bounds so collision edge point shifts do not skip neighbors
+#define PHYS_BROADPHASE_MARGIN 0.05f
+// Called with the objects in a cell and the distance along the ray where the ray leaves the cell. Return false to stop.
+#define RAY_VISIT_FUNC std::function<bool(const vector<uint> &, float)>
+
+enum class PhysicsBroadphase {
+    SPATIAL_HASH,
+    BRUTE_FORCE
+};
+
+/**
+ * @brief Uniform grid keyed on a hash of the integer cell coordinates. Objects are inserted using their
+ * collider AABB and are referenced by an index supplied by the caller. Queries return the sorted, unique
+ * indices of every object sharing at least one cell with the queried bounds.
+ */
+class SpatialHash {
+ public:
+    explicit SpatialHash(float cellSize = PHYS_BROADPHASE_CELL_SIZE);
+    /**
+     * @brief Removes all objects from the hash.
+     */
+    void clear();
+    /**
+     * @brief Inserts an object into every cell its bounds overlap.
+     * @param index Caller defined index for the object, returned by query.
+     * @param minBound Minimum corner of the object's AABB.
+     * @param maxBound Maximum corner of the object's AABB.
+     */
+    void insert(uint index, const vec3 &minBound, const vec3 &maxBound);
+    /**
+     * @brief Collects the indices of all objects that may overlap the given bounds. This is read only, so it
+     * is safe to call from multiple threads once the hash has been built.
+     * @param minBound Minimum corner of the AABB to query.
+     * @param maxBound Maximum corner of the AABB to query.
+     * @param candidates Output vector, cleared before use. Indices are sorted and unique.
+     */
+    void query(const vec3 &minBound, const vec3 &maxBound, vector<uint> *candidates) const;
+    /**
+     * @brief Walks the occupied cells a ray passes through, nearest first. Oversized objects are visited first with
+     * an exit distance of 0. When the ray crosses more cells than are occupied, every occupied cell is visited
+     * instead, each with an exit distance of maxDistance. Read only, like query.
+     * @param origin Start of the ray.
+     * @param direction Normalized direction of the ray.
+     * @param maxDistance Length of the ray.
+     * @param visit Called for each occupied cell. Objects spanning several cells are seen more than once.
+     */
+    void traverseRay(const vec3 &origin, const vec3 &direction, float maxDistance, const RAY_VISIT_FUNC &visit) const;
+    /**
+     * @brief Changes the cell size of the hash. Clears the hash when the size changes.
+     * @param cellSize New cell edge length in world units. Non-positive values are ignored.
+     */
+    void setCellSize(float cellSize);
+    inline float cellSize() const { return cellSize_; }
+    inline size_t cellCount() const { return cells_.size(); }
+
+ private:
+    glm::ivec3 cellCoord(const vec3 &point) const;
+    static uint64_t hashCell(int x, int y, int z);
+
+    float cellSize_;
+    float invCellSize_;
+    std::unordered_map<uint64_t, vector<uint>> cells_;
+    vector<uint> oversized_;
+};
@@ -0,0 +1,77 @@
+/**
+ * @file PhysicsCommandQueue.hpp
+ * @author Alec Jackson
+ * @brief Lock-free queue of body changes waiting to be applied by the physics controller
+ * @version 0.1
+ * @date 2025
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+#include <common.hpp>
+#include <PhysicsBodyStore.hpp>
+
+// Commands the queue can hold before callers spill the rest into the physics controller's overflow list
+#define PHYS_COMMAND_QUEUE_SIZE 4096
+
+enum class PhysicsCommandType {
+    SET_POSITION,
+    SET_VELOCITY,
+    SET_ACCELERATION,
+    APPLY_FORCE,
+    APPLY_INSTANT_FORCE,
+    TRANSLATE,
+    WAKE
+};
+
+// A single change to a body. The meaning of value depends on type, and is unused for WAKE.
+struct PhysicsCommand {
+    PhysicsCommandType  type;
+    PhysicsHandle       handle;
+    vec3                value;
+};
+
+/**
+ * @brief Bounded multi-producer queue of PhysicsCommands. Every cell carries a sequence number that tells producers
+ * and consumers whose turn it is, so pushing and popping only take a compare and swap on the queue position and never
+ * block. Commands come out in the order their pushes claimed a cell.
+ */
+class PhysicsCommandQueue {
+ public:
+    /**
+     * @brief Creates an empty queue.
+     * @param capacity Number of commands the queue can hold. Rounded up to a power of two.
+     */
+    explicit PhysicsCommandQueue(uint capacity = PHYS_COMMAND_QUEUE_SIZE);
+    /**
+     * @brief Adds a command to the back of the queue. Safe to call from any thread.
+     * @param command Command to add.
+     * @return true when the command was queued, false when the queue is full.
+     */
+    bool push(const PhysicsCommand &command);
+    /**
+     * @brief Takes the command at the front of the queue. Safe to call from any thread.
+     * @param command Output for the command.
+     * @return true when a command was taken, false when the queue is empty.
+     */
+    bool pop(PhysicsCommand *command);
+    inline uint capacity() const { return static_cast<uint>(mask_ + 1); }
+
+ private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        PhysicsCommand command;
+    };
+    std::unique_ptr<Cell[]> cells_;
+    size_t mask_;
+    // Producers and the consumer hammer different positions, so keep them on separate cache lines
+    alignas(64) std::atomic<size_t> enqueuePos_ { 0 };
+    alignas(64) std::atomic<size_t> dequeuePos_ { 0 };
+};
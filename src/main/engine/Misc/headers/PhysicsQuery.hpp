@@ -0,0 +1,150 @@
+/**
+ * @file PhysicsQuery.hpp
+ * @author Alec Jackson
+ * @brief Read-only snapshot of the physics bodies used to answer raycast, sweep and overlap queries
+ * @version 0.1
+ * @date 2025
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include <common.hpp>
+#include <SceneObject.hpp>
+#include <PhysicsBodyStore.hpp>
+#include <PhysicsBroadphase.hpp>
+#include <MeshCollider.hpp>
+#include <CollisionKernel.hpp>
+
+// Queries treat boxes as this much larger on every side, so rays skimming a face and flat colliders still register
+#define PHYS_QUERY_SKIN PHYS_COLLISION_EPSILON
+
+// A body found by a PhysicsQueryWorld query
+struct PhysicsQueryHit {
+    PhysicsHandle   handle = PHYS_INVALID_HANDLE;
+    SceneObject     *object = nullptr;  // Only valid while the body is still in the PhysicsController
+    float           distance = 0.0f;  // Distance travelled along the query direction. 0 for overlaps and starts inside.
+    vec3            point = vec3(0.0f);  // Ray end or box center at the hit. The query center for overlaps.
+    vec3            normal = vec3(0.0f);  // Face of the body that was hit. Opposes the direction when starting inside.
+};
+
+/**
+ * @brief Immutable copy of every body's collider box at the end of a physics step, indexed by its own spatial hash.
+ * The PhysicsController fills a new world after each update and swaps it in, so once published a world is never
+ * written again and any number of threads can query it at once without touching the physics locks.
+ */
+class PhysicsQueryWorld {
+ public:
+    /**
+     * @brief Creates an empty world.
+     * @param cellSize Edge length of a spatial hash cell, normally the PhysicsController's broadphase cell size.
+     */
+    explicit PhysicsQueryWorld(float cellSize);
+    /**
+     * @brief Adds a body's collider box. Only called while the world is being built.
+     * @param handle Handle of the body.
+     * @param object SceneObject of the body.
+     * @param layer Collider layer of the body.
+     * @param minBound Minimum corner of the collider box.
+     * @param maxBound Maximum corner of the collider box.
+     * @param mesh Triangles queries test in place of the box, or nullptr to test the box.
+     * @param meshPosition World position of the mesh.
+     * @param meshScale Scale applied to the mesh's model space triangles.
+     */
+    void add(PhysicsHandle handle, SceneObject *object, uint32_t layer, const vec3 &minBound, const vec3 &maxBound,
+        std::shared_ptr<const MeshCollider> mesh = nullptr, const vec3 &meshPosition = vec3(0.0f),
+        const vec3 &meshScale = vec3(1.0f));
+    /**
+     * @brief Finds the first body a ray hits.
+     * @param origin Start of the ray.
+     * @param direction Direction of the ray. Does not need to be normalized.
+     * @param maxDistance Length of the ray.
+     * @param mask Layers to test against. Bodies whose layer shares no bits with mask are ignored.
+     * @param hit Output for the closest hit. Left unchanged on a miss.
+     * @return true when the ray hits a body.
+     */
+    bool raycast(const vec3 &origin, const vec3 &direction, float maxDistance, uint32_t mask,
+        PhysicsQueryHit *hit) const;
+    /**
+     * @brief Finds the first body a box hits while moving in a straight line. Mesh bodies are swept against the
+     * bounds of each of their triangles.
+     * @param center Center of the box at the start of the sweep.
+     * @param halfExtents Half extents of the box.
+     * @param direction Direction to move the box in. Does not need to be normalized.
+     * @param maxDistance Distance to move the box.
+     * @param mask Layers to test against.
+     * @param hit Output for the closest hit. Left unchanged on a miss.
+     * @return true when the box hits a body.
+     */
+    bool sweepBox(const vec3 &center, const vec3 &halfExtents, const vec3 &direction, float maxDistance,
+        uint32_t mask, PhysicsQueryHit *hit) const;
+    /**
+     * @brief Finds every body overlapping a box. Mesh bodies only count when a triangle touches the box.
+     * @param center Center of the box.
+     * @param halfExtents Half extents of the box.
+     * @param mask Layers to test against.
+     * @param hits Output for the overlapping bodies in ascending handle order. Cleared first.
+     * @return Number of overlapping bodies.
+     */
+    uint overlapBox(const vec3 &center, const vec3 &halfExtents, uint32_t mask, vector<PhysicsQueryHit> *hits) const;
+    inline uint size() const { return static_cast<uint>(handles_.size()); }
+
+ private:
+    // Closest hit found so far by a cast
+    struct CastResult {
+        float   fraction = PHYS_SWEEP_MISS;  // Fraction of the motion travelled
+        uint    index = 0;  // Body hit
+        vec3    boxMin = vec3(0.0f);  // Box that was hit, used to pick the hit normal
+        vec3    boxMax = vec3(0.0f);
+        bool    hasNormal = false;  // Set when normal was taken from a triangle instead
+        vec3    normal = vec3(0.0f);
+    };
+    /**
+     * @brief Tests a box moving from center by motion against one body, keeping the hit if it is the closest so far.
+     * @param index Body to test.
+     * @param best Closest hit so far. Updated on a closer hit.
+     */
+    void castAgainst(uint index, const vec3 &center, const vec3 &halfExtents, const vec3 &motion, uint32_t mask,
+        CastResult *best) const;
+    /**
+     * @brief Tests a cast against the triangles of a mesh body. Rays hit the triangles themselves, boxes hit the
+     * bounds of each triangle.
+     */
+    void castAgainstMesh(uint index, const vec3 &center, const vec3 &halfExtents, const vec3 &motion,
+        CastResult *best) const;
+    /**
+     * @brief Keeps a box hit if it is closer than the best so far. Ties go to the lower handle.
+     * @return true when the hit was kept.
+     */
+    bool keepCloser(uint index, float fraction, const vec3 &boxMin, const vec3 &boxMax, CastResult *best) const;
+    /**
+     * @brief Fills hit from the closest result of a cast.
+     */
+    void fillCastHit(const CastResult &best, const vec3 &center, const vec3 &halfExtents, const vec3 &motion,
+        PhysicsQueryHit *hit) const;
+    /**
+     * @brief Checks whether a box touches any triangle of a mesh body.
+     */
+    bool overlapsMesh(uint index, const vec3 &center, const vec3 &halfExtents) const;
+    /**
+     * @brief Maps a world space box into a mesh body's model space.
+     */
+    void toMeshSpace(uint index, const vec3 &minBound, const vec3 &maxBound, vec3 *localMin, vec3 *localMax) const;
+    // World space corner of a mesh body's triangle
+    inline vec3 meshCorner(uint index, uint triangle, uint corner) const {
+        return meshPositions_[index] + meshScales_[index] * meshes_[index]->vertex(triangle, corner);
+    }
+    vector<PhysicsHandle> handles_;
+    vector<SceneObject *> objects_;
+    vector<uint32_t> layers_;
+    vector<std::shared_ptr<const MeshCollider>> meshes_;
+    vector<vec3> meshPositions_;
+    vector<vec3> meshScales_;
+    AabbBatch boxes_;
+    SpatialHash hash_;
+};
@@ -0,0 +1,82 @@
+/**
+ * @file RenderQueue.hpp
+ * @author Alec Jackson
+ * @brief Per-frame list of draw packets, sorted by state so objects sharing a program and texture render together
+ * @version 0.1
+ * @date 2025
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <common.hpp>
+
+class SceneObject;
+
+/*
+ * Sort key layout, most significant bits first. Priority sits on top so render priority order always wins, the rest
+ * only order objects within a priority. Then comes the blended bit, so opaque objects draw before blended ones.
+ * Opaque keys continue with program, texture, VAO and depth. Ids wider than their field are truncated, which can only
+ * cost a few extra state changes. Blended keys continue with depth and the order the packet was pushed in, since
+ * blended objects have to be painted in order whatever state they share.
+ */
+#define RENDER_KEY_PRIORITY_BITS 8
+#define RENDER_KEY_BLENDED_BITS 1
+#define RENDER_KEY_PROGRAM_BITS 10
+#define RENDER_KEY_TEXTURE_BITS 16
+#define RENDER_KEY_VAO_BITS 14
+#define RENDER_KEY_DEPTH_BITS 15
+#define RENDER_KEY_SEQUENCE_BITS 40
+// Bits sorted by each radix sort pass
+#define RENDER_SORT_RADIX_BITS 8
+
+// A single object to draw this frame
+struct RenderPacket {
+    uint64_t    key = 0;  // Built with RenderQueue::makeKey
+    SceneObject *object = nullptr;
+};
+
+/**
+ * @brief Collects the draw packets of a frame and orders them by their sort key before they are submitted. Filled
+ * and drained on the render thread only.
+ */
+class RenderQueue {
+ public:
+    /**
+     * @brief Packs the state an opaque object renders with into a sort key.
+     * @param priority Render priority of the object, RENDER_PRIOR_LOWEST to RENDER_PRIOR_HIGHEST.
+     * @param program Shader program the object sets.
+     * @param texture Texture the object binds, 0 for none.
+     * @param vao VAO the object binds.
+     * @param depth Depth of the object from 0 (near) to 1 (far). Clamped.
+     * @return Key that sorts by priority, then program, texture, VAO and front to back depth.
+     */
+    static uint64_t makeKey(uint priority, uint program, uint texture, uint vao, float depth);
+    /**
+     * @brief Builds the sort key of a blended object, which has to be painted over whatever is behind it. Shared state
+     * is left out of the key, so only objects that end up next to each other can share a draw.
+     * @param priority Render priority of the object, RENDER_PRIOR_LOWEST to RENDER_PRIOR_HIGHEST.
+     * @param depth Depth of the object from 0 (near) to 1 (far). Clamped.
+     * @param sequence Order the object was submitted in this frame.
+     * @return Key that sorts by priority after every opaque key of that priority, then back to front depth, then
+     * submission order.
+     */
+    static uint64_t makeBlendedKey(uint priority, float depth, uint64_t sequence);
+    inline void push(const RenderPacket &packet) { packets_.push_back(packet); }
+    /**
+     * @brief Sorts the packets by key with an LSD radix sort. Stable, so packets with equal keys keep the order they
+     * were pushed in. Passes where every key has the same digit are skipped.
+     */
+    void sort();
+    inline void clear() { packets_.clear(); }
+    inline const vector<RenderPacket> &packets() const { return packets_; }
+    inline size_t size() const { return packets_.size(); }
+
+ private:
+    vector<RenderPacket> packets_;
+    vector<RenderPacket> scratch_;  // Kept between frames so sorting does not allocate
+};
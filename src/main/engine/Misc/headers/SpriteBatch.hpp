@@ -0,0 +1,75 @@
+/**
+ * @file SpriteBatch.hpp
+ * @author Alec Jackson
+ * @brief Collects the quads of many 2D objects into one dynamic vertex buffer, drawn with one call per texture
+ * @version 0.1
+ * @date 2025
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#pragma once
+
+#include <climits>
+#include <vector>
+#include <common.hpp>
+#include <GfxController.hpp>
+
+// Attribute locations of the batch buffers, shared by the spriteObject and uiObject shaders
+#define SPRITE_BATCH_VERTEX_ATTR 0
+#define SPRITE_BATCH_TINT_ATTR 1
+// Floats per vertex in both buffers, <vec2 pos, vec2 tex> and <vec4 tint>
+#define SPRITE_BATCH_VERTEX_FLOATS 4
+#define SPRITE_BATCH_TINT_FLOATS 4
+
+// Run of batched vertices that share a texture
+struct SpriteBatchDraw {
+    uint texture = 0;
+    uint first = 0;  // First vertex of the run
+    uint vertexCount = 0;
+};
+
+/**
+ * @brief Builds the vertices of a batch of 2D objects on the CPU, then uploads them into one dynamic buffer and draws
+ * each run of vertices sharing a texture with a single call. Objects are drawn in the order they were added, so a
+ * batch keeps painter's order. Filled and drawn on the render thread only.
+ */
+class SpriteBatch {
+ public:
+    ~SpriteBatch();
+    /**
+     * @brief Transforms an object's vertices into world space and appends them to the batch. Joins the previous run
+     * when the texture matches, otherwise starts a new one.
+     * @param texture Texture the vertices are drawn with.
+     * @param model Model matrix of the object.
+     * @param vertices Object space vertices, SPRITE_BATCH_VERTEX_FLOATS floats per vertex.
+     * @param vertexCount Number of vertices to add.
+     * @param tint Tint given to every added vertex.
+     */
+    void add(uint texture, const mat4 &model, const float *vertices, uint vertexCount, const vec4 &tint);
+    /**
+     * @brief Uploads the batch and draws every texture run. The caller sets the program and its uniforms first.
+     * @param gfxController Controller to draw with. The buffers are created on the first draw.
+     */
+    void draw(GfxController *gfxController);
+    inline void clear() { vertices_.clear(); tints_.clear(); draws_.clear(); }
+    inline const vector<SpriteBatchDraw> &draws() const { return draws_; }
+    inline uint vertexCount() const { return vertices_.size() / SPRITE_BATCH_VERTEX_FLOATS; }
+
+ private:
+    void upload(GfxController *gfxController);
+    /**
+     * @brief Deletes the VAO and buffers from the controller that created them, so the next upload starts over.
+     */
+    void release();
+
+    vector<float> vertices_;
+    vector<float> tints_;
+    vector<SpriteBatchDraw> draws_;
+    GfxController *gfxController_ = nullptr;  // Controller the buffers were created with
+    uint vao_ = UINT_MAX;
+    uint vertexBuffer_ = UINT_MAX;
+    uint tintBuffer_ = UINT_MAX;
+    uint capacity_ = 0;  // Vertices the buffers can hold without growing
+};
@@ -22,11 +22,19 @@
 #include <atomic>
 #include <memory>
 #include <functional>
+#include <cassert>
 #include <SceneObject.hpp>
 #include <ColliderExt.hpp>
+#include <PhysicsBroadphase.hpp>
+#include <PhysicsBodyStore.hpp>
+#include <PhysicsCommandQueue.hpp>
+#include <PhysicsQuery.hpp>
+#include <CollisionKernel.hpp>
+#include <JobSystem.hpp>
+#include <FrameContext.hpp>
 #include <glm/fwd.hpp>
 
-#define SUBSCRIPTION_PARAM std::function<PhysicsReport *(void)>
+#define SUBSCRIPTION_PARAM std::function<void(const PhysicsReport &)>
 #define PHYS_MAX_THREADS 256
 #define PHYS_TRACE 0
 #define MAX_PHYSICS_UPDATE_TIME 10.0f
@@ -36,63 +44,114 @@
 #define PHYS_THREADS 1
 #endif
 #define GRAVITY_CONST 9.81f
+// Most fixed steps a single update call will run before dropping the remaining time
+#define PHYS_DEFAULT_MAX_SUBSTEPS 8
+// Steps a body has to spend at rest before it is put to sleep
+#define PHYS_SLEEP_FRAMES 30
+// Overlap a continuous body is left with at its first contact, so the discrete checks respond to the contact
+#define PHYS_CCD_SKIN (4.0f * PHYS_COLLISION_EPSILON)
+// Passes the contact solver makes over each step's contacts
+#define PHYS_DEFAULT_SOLVER_ITERATIONS 4
 
 enum PhysicsWorkType {
     POSITION,
     COLLISION,
     FINALIZE,
     SUBMIT,
-    DIE
+    ADOPT,
+    PUBLISH,
+    WAKE,
+    SOLVE,
+    CORRECT
 };
 
-// Internal - used in physics component
+/**
+ * @brief Accessor for a single body in the PhysicsController's body store. Holds the body's handle rather than its
+ * index, so it stays valid while other bodies are added or removed. Every field accessor wakes the body, since the
+ * caller may write through the returned reference. Not thread safe - intended for unit tests and debugging.
+ */
 class PhysicsObject {
  public:
-    SceneObject *        target;
-    ColliderExt *        targetCollider;
-    vec3                 position;
-    vec3                 prevPos;
-    vec3                 positionDelta = vec3(0.0f);
-    vec3                 velocity;
-    vec3                 velocityDelta = vec3(0.0f);
-    bool                 hasCollision = false;
-    vec3                 acceleration;
-    vec3                 jerk;
-    bool                 isKinematic;
-    bool                 obeyGravity;
-    vec3                 impulse;
-    float                elasticity;
-    float                mass;
-    double               runningTime;
-    double               gravTime;
-    PhysicsWorkType      workType;  // Might want to move this to a work queue specific class...
-    std::mutex           objLock;
-    /**
-     * @brief Updates the position of the target object using the position formula.
-     */
-    void updatePosition();
-    /**
-     * @brief Resets the reference position to the object's real position to allow the runningTime
-     * counter to be reset without moving the object backwards.
-     */
-    void flushPosition();
-    /**
-     * @brief Updates the reference velocity to velocity + acceleration * runningTime to maintain
-     * momentum of objects before a runningTime reset.
-     */
-    void flushVelocity();
-    /**
-     * @brief Does nothing for now, but will be useful when jerk is implemented.
-     */
-    void flushAcceleration();
-    /**
-     * @brief Runs position, velocity, acceleration flushes and resets the runningTime counter back
-     * to zero.
-     */
-    void fullFlush();
+    inline PhysicsObject(PhysicsBodyStore *store, PhysicsHandle handle) : store_ { store }, handle_ { handle } {}
+    inline PhysicsHandle handle() const { return handle_; }
+    inline bool valid() const { return store_->indexOf(handle_) != PHYS_INVALID_INDEX; }
+    inline bool asleep() const { return store_->asleep(index()); }
+    inline SceneObject *&target() { return store_->target[wakeIndex()]; }
+    inline ColliderExt *&targetCollider() { return store_->collider[wakeIndex()]; }
+    inline vec3 &position() { return store_->position[wakeIndex()]; }
+    inline vec3 &prevPos() { return store_->prevPos[wakeIndex()]; }
+    inline vec3 &velocity() { return store_->velocity[wakeIndex()]; }
+    inline vec3 &acceleration() { return store_->acceleration[wakeIndex()]; }
+    inline double &runningTime() { return store_->runningTime[wakeIndex()]; }
+    inline double &gravTime() { return store_->gravTime[wakeIndex()]; }
+    inline float &elasticity() { return store_->elasticity[wakeIndex()]; }
+    inline float &mass() { return store_->mass[wakeIndex()]; }
+    inline uint8_t &isKinematic() { return store_->isKinematic[wakeIndex()]; }
+    inline uint8_t &obeyGravity() { return store_->obeyGravity[wakeIndex()]; }
+
+ private:
+    inline uint index() const {
+        auto index = store_->indexOf(handle_);
+        assert(index != PHYS_INVALID_INDEX);
+        return index;
+    }
+    inline uint wakeIndex() {
+        auto index = this->index();
+        store_->wake(index);
+        return index;
+    }
+    PhysicsBodyStore *store_;
+    PhysicsHandle handle_;
+};
 
-    void updateCollision(const map<string, std::shared_ptr<PhysicsObject>> &objects);
-    void updateFinalize();
+// Wall clock time spent in each pipeline stage during the last update, in milliseconds
+struct PhysicsStageTiming {
+    double              positionMs = 0.0;
+    double              collisionMs = 0.0;
+    double              finalizeMs = 0.0;
+    double              solveMs = 0.0;
+    double              submitMs = 0.0;
+};
+
+/**
+ * @brief Counters for the most recent update call, summed over every step it ran. Counted with one relaxed atomic add
+ * per batch rather than per body, so they are always on.
+ */
+struct PhysicsStats {
+    PhysicsStageTiming  timing;
+    uint64_t            step = 0;  // Steps run since the controller was created
+    uint                substeps = 0;  // Steps run by the update call
+    uint                bodies = 0;  // Bodies in the controller
+    uint                awakeBodies = 0;  // Bodies awake at the end of the update call
+    uint64_t            pairsTested = 0;  // Candidate boxes the COLLISION and WAKE stages tested for overlap
+    uint64_t            contactsFound = 0;  // Candidate boxes found overlapping. Kinematic pairs count twice.
+    uint64_t            solverPasses = 0;  // Contact solver passes that moved at least one body
+    uint64_t            jobsRun = 0;  // Job system jobs finished during the update
+    double              queueWaitMs = 0.0;  // Time those jobs sat queued before a thread picked them up
+    double              workerIdleMs = 0.0;  // Time job system workers spent asleep waiting for work during the update
+};
+
+// Scratch buffers for the COLLISION stage. Each worker thread keeps its own copy and reuses it across batches.
+struct CollisionScratch {
+    vector<uint>        indices;  // Spatial hash query results
+    vector<uint>        candidates;  // Bodies returned by the broadphase
+    vector<uint>        sleepingCandidates;  // Sleeping bodies returned by the broadphase
+    vector<uint>        others;  // Candidates with colliders, in the same order as the boxes below
+    vector<vec3>        centers;  // Candidate box centers at their current positions
+    vector<vec3>        offsets;  // Candidate box half extents
+    vector<vec3>        prevCenters;  // Candidate box centers before the POSITION stage
+    vector<uint>        triangles;  // Mesh candidates: first corner in corners. PHYS_INVALID_INDEX for other bodies.
+    vector<vec3>        corners;  // World space corners of the mesh triangles being tested
+    vector<uint>        meshTriangles;  // MeshCollider query results
+    AabbBatch           current;  // Candidate boxes at their current positions
+    AabbBatch           previous;  // Candidate boxes at their positions before the POSITION stage
+    vector<uint8_t>     currentMasks;
+    vector<uint8_t>     previousMasks;
+    vector<uint64_t>    contacts;  // Contact pairs found by this thread's current batch
+    vector<uint>        solverBodies;  // Bodies with contacts for the contact solver found by the current batch
+    vector<PhysicsContactCache> previousCache;  // Contact cache of the body being updated, as of the last step
+    uint64_t            pairsTested = 0;  // Counted per body, added to the controller's stats once per batch
+    uint64_t            contactsFound = 0;
 };
 
 struct PhysicsParams {
@@ -100,12 +159,42 @@ struct PhysicsParams {
     bool                obeyGravity;
     float               elasticity;
     float               mass;
+    // Sweep the collider from its previous position so fast bodies cannot pass through thin colliders. Kinematic only.
+    bool                continuousCollision = false;
+    // Collision filter written to the object's collider when the object is added. 0 keeps the collider's own value.
+    uint32_t            collisionLayer = 0;
+    uint32_t            collisionMask = 0;
+    // Static triangle mesh tested in place of the collider box, which is then only used by the broadphase. The body
+    // never moves on contact, so isKinematic is ignored. The mesh is mapped through the object's position and scale.
+    std::shared_ptr<const MeshCollider> mesh = nullptr;
 };
 
-// External - published to subscribers
+// A body added since the last update. The handle is handed out by addSceneObject before the body is in the store.
+struct PhysicsPendingAdd {
+    SceneObject     *object;
+    PhysicsParams   params;
+    PhysicsHandle   handle;
+};
+
+enum class PhysicsContactType {
+    BEGIN,  // The bodies started touching this step
+    PERSIST,  // The bodies were already touching last step
+    END  // The bodies stopped touching this step
+};
+
+// A change in contact between two bodies. body always has the lower handle of the pair.
+struct PhysicsContact {
+    PhysicsContactType  type;
+    PhysicsHandle       body;
+    PhysicsHandle       other;
+    SceneObject         *bodyObject;  // nullptr when the body was removed from the PhysicsController
+    SceneObject         *otherObject;
+};
+
+// External - published to subscribers once per step
 struct PhysicsReport {
-    SceneObject *parentObject;
-    vector<SceneObject *> collisions;
+    uint64_t                step;  // Number of steps the PhysicsController has run, including this one
+    vector<PhysicsContact>  contacts;
 };
 
 struct PhysicsSubscriber {
@@ -126,69 +215,546 @@ float basicPhysics(float* pos, float fallspeed);
 class PhysicsController {
  public:
     /**
-     * @brief Creates a new physics controller with a given number of worker threads.
-     * @param threadNum Number of worker threads to create for the PhysicsController.
+     * @brief Creates a new physics controller with its own job system.
+     * @param threadNum Number of worker threads to create for the PhysicsController's job system.
      */
     explicit PhysicsController(uint threadNum);
     /**
-     * @brief Adds a SceneObject to the PhysicsController for it to operate on.
+     * @brief Creates a new physics controller that submits its work to a shared job system.
+     * @param jobSystem Engine job system to run the physics stages on. Must outlive the PhysicsController.
+     */
+    explicit PhysicsController(JobSystem *jobSystem);
+    /**
+     * @brief Adds a SceneObject to the PhysicsController for it to operate on. The body joins the store at the start
+     * of the next update call, before any changes queued for it are applied, so this never waits on an update in
+     * flight. The object's name and handle can be used straight away.
      * @param object Target object for physics controller to update.
      * @param params Physical attributes of object being added to PhysicsController.
-     * @return PhysicsResult::OK when object added successfully.
+     * @return Handle for the new body. Keep it around and pass it to the handle overloads below instead of the
+     * object's name.
      */
-    PhysicsResult addSceneObject(SceneObject *object, PhysicsParams params);
+    PhysicsHandle addSceneObject(SceneObject *object, PhysicsParams params);
     /**
-     * @brief Removes a scene object from the physics controller.
+     * @brief Removes a scene object from the physics controller. Waits for any update in flight, since the steps and
+     * the next sync read the target, so the caller is free to destroy the object as soon as this returns.
      * @param objectName Name of SceneObject to remove from PhysicsController.
      * @return PhysicsResult::OK when object is discovered and removed. PhysicsObject::FAILURE when object is
      * not discovered, so nothing happens.
      */
     PhysicsResult removeSceneObject(string objectName);
+    PhysicsResult removeSceneObject(PhysicsHandle handle);
     /**
-     * @brief Fetches a physics object from the PhysicsController. This is not thread safe, and is designed to
-     * only be used in unit tests.
+     * @brief Fetches an accessor for a body in the PhysicsController. This is not thread safe, and is designed to
+     * only be used in unit tests. Waits for any update in flight, then lands the bodies added or removed since the
+     * last update so the accessor is valid straight away.
      * @param objectName Object to fetch from the PhysicsController.
      * @return shared pointer containing the discovered object if present. Invalid shared pointer is returned when
      * the object is not discovered.
      */
     std::shared_ptr<PhysicsObject> getPhysicsObject(string objectName);
+    /**
+     * @brief Looks up the handle of a body by the name of its SceneObject.
+     * @param objectName Name of the SceneObject to look up.
+     * @return Handle of the body, or PHYS_INVALID_HANDLE when the object is not in the PhysicsController.
+     */
+    PhysicsHandle getHandle(string objectName);
     /**
      * @brief Sets the reference position of a SceneObject in the PhysicsController.
      * @param objectName SceneObject in the PhysicsController to set the reference position to.
      * @param position New reference position to set for the SceneObject.
-     * @return PhysicsResult::OK when an object is discovered and has its position set. Otherwise,
+     * @return PhysicsResult::OK when an object is discovered and has its position change queued. Otherwise,
      * PhysicsResult::FAILURE is returned and no objects are changed.
+     *
+     * The named setters look the body up once and then queue the change like the handle overloads below, so it lands
+     * at the start of the next update call, in order with every other change made through a name or a handle.
      */
     PhysicsResult setPosition(string objectName, vec3 position);
     PhysicsResult setVelocity(string objectName, vec3 velocity);
     PhysicsResult setAcceleration(string objectName, vec3 acceleration);
     PhysicsResult applyForce(string objectName, vec3 force);
+    // The force is spread over the frame time of the update it lands in
     PhysicsResult applyInstantForce(string objectName, vec3 force);
     PhysicsResult translate(string objectName, vec3 direction);
+    /**
+     * @brief Wakes a sleeping body. Only needed when a body's SceneObject is changed outside of the
+     * PhysicsController, since every PhysicsController setter already wakes the body it changes.
+     * @param objectName SceneObject to wake.
+     * @return PhysicsResult::OK when the object is discovered, PhysicsResult::FAILURE otherwise.
+     */
+    PhysicsResult wake(string objectName);
+    /*
+     * Handle overloads of the setters above. These do not take physicsObjectQueueLock_ - each change is pushed onto a
+     * lock-free queue and applied at the start of the next update call, in the order the calls were made. Game
+     * threads can call them every frame without waiting on the physics pipeline. They return PhysicsResult::OK once
+     * the change is queued; a handle that no longer refers to a body is reported and skipped when it is applied.
+     */
+    PhysicsResult setPosition(PhysicsHandle handle, vec3 position);
+    PhysicsResult setVelocity(PhysicsHandle handle, vec3 velocity);
+    PhysicsResult setAcceleration(PhysicsHandle handle, vec3 acceleration);
+    PhysicsResult applyForce(PhysicsHandle handle, vec3 force);
+    PhysicsResult applyInstantForce(PhysicsHandle handle, vec3 force);
+    PhysicsResult translate(PhysicsHandle handle, vec3 direction);
+    PhysicsResult wake(PhysicsHandle handle);
+    /**
+     * @brief Registers a callback that receives every contact begin, persist and end event once per step. Callbacks
+     * run on the thread calling sync (or update), once the steps have been published and without any physics locks
+     * held, so they may call back into the PhysicsController. Steps without contact events do not produce a report.
+     * @param name Name of the subscriber. Subscribing again under the same name replaces the old callback.
+     * @param callback Function to deliver each PhysicsReport to.
+     * @return PhysicsResult::OK
+     */
+    PhysicsResult subscribe(string name, SUBSCRIPTION_PARAM callback);
+    /**
+     * @brief Removes a subscriber added with subscribe.
+     * @param name Name of the subscriber to remove.
+     * @return PhysicsResult::OK when the subscriber is discovered and removed, PhysicsResult::FAILURE otherwise.
+     */
+    PhysicsResult unsubscribe(string name);
+    /*
+     * Scene queries. These run against a PhysicsQueryWorld snapshot of every collider box taken at the end of the last
+     * update call, so any thread may call them at any time - they never wait on the physics pipeline and never see a
+     * step half finished. Only bodies whose collider layer shares a bit with mask are considered.
+     */
+    /**
+     * @brief Finds the first body a ray hits.
+     * @param origin Start of the ray.
+     * @param direction Direction of the ray. Does not need to be normalized.
+     * @param maxDistance Length of the ray.
+     * @param hit Output for the closest hit.
+     * @param mask Collider layers to test against.
+     * @return true when the ray hits a body.
+     */
+    bool raycast(vec3 origin, vec3 direction, float maxDistance, PhysicsQueryHit *hit,
+        uint32_t mask = COLLIDER_MASK_ALL);
+    /**
+     * @brief Finds the first body a box hits while moving in a straight line.
+     * @param center Center of the box at the start of the sweep.
+     * @param halfExtents Half extents of the box.
+     * @param direction Direction to move the box in. Does not need to be normalized.
+     * @param maxDistance Distance to move the box.
+     * @param hit Output for the closest hit.
+     * @param mask Collider layers to test against.
+     * @return true when the box hits a body.
+     */
+    bool sweepBox(vec3 center, vec3 halfExtents, vec3 direction, float maxDistance, PhysicsQueryHit *hit,
+        uint32_t mask = COLLIDER_MASK_ALL);
+    /**
+     * @brief Finds every body overlapping a box.
+     * @param center Center of the box.
+     * @param halfExtents Half extents of the box.
+     * @param hits Output for the overlapping bodies in ascending handle order.
+     * @param mask Collider layers to test against.
+     * @return Number of overlapping bodies.
+     */
+    uint overlapBox(vec3 center, vec3 halfExtents, vector<PhysicsQueryHit> *hits, uint32_t mask = COLLIDER_MASK_ALL);
+    /**
+     * @brief Fetches the snapshot the queries above run against. Holding on to it keeps a consistent view across
+     * several queries, even while later updates publish newer snapshots.
+     * @return The snapshot of the last update call. Empty before the first update.
+     */
+    std::shared_ptr<const PhysicsQueryWorld> getQueryWorld();
+    // Number of bodies that are awake and run through the pipeline stages
+    inline uint getActiveBodyCount() { return bodies_.activeCount(); }
     PhysicsResult schedulePosition();
     PhysicsResult scheduleCollision();
     PhysicsResult scheduleFinalize();
-    inline bool isPipelineComplete() { return workQueue_.empty() && freeWorkers_ == threadNum_; }
+    inline bool isPipelineComplete() { return JobSystem::isComplete(stageJob_); }
     PhysicsResult waitPipelineComplete();
+    /**
+     * @brief Advances the simulation by the frame's scaled delta time and publishes the result to the targets. Same
+     * as updateAsync followed by sync.
+     * @param frame Timing of the frame being updated.
+     */
+    void update(const FrameContext &frame);
+    // Same as update(frame) with a frame built from the deltaTime global, for callers without a FrameContext
     void update();
-    PhysicsResult doWork();
+    /**
+     * @brief Starts advancing the simulation by the frame's scaled delta time on the job system and returns straight
+     * away. In variable rate mode this runs a single step of frame.deltaTime (capped to MAX_PHYSICS_UPDATE_TIME). In
+     * fixed rate mode frame.deltaTime is added to an accumulator and as many fixed steps as fit are run, so a paused
+     * frame runs no steps. The steps only work on the body store, so targets keep the positions of the last sync and
+     * can be rendered while the steps run. Lands any update still in flight first.
+     * @param frame Timing of the frame being updated. Copied, so it does not need to outlive the call.
+     */
+    void updateAsync(const FrameContext &frame);
+    // Same as updateAsync(frame) with a frame built from the deltaTime global, for callers without a FrameContext
+    void updateAsync();
+    /**
+     * @brief Waits for the update started by updateAsync and publishes it - each target is moved to its simulated
+     * position (interpolated between its last two steps in fixed rate mode), the stats are published and the contact
+     * reports of every step are delivered to the subscribers on the calling thread. Does nothing when no update is
+     * in flight. Call before reading target positions the physics controller moves.
+     * @return PhysicsResult::OK, or PhysicsResult::SHUTDOWN once the controller has shut down.
+     */
+    PhysicsResult sync();
+    // True once the steps started by updateAsync have finished. sync still has to be called to publish them.
+    inline bool isUpdateComplete() { return JobSystem::isComplete(updateJob_); }
+    /**
+     * @brief Selects between variable and fixed rate stepping. Should not be called while the pipeline is running.
+     * @param hz Simulation steps per second. 0 switches back to a single variable step per update call.
+     * @param maxSubsteps Most steps a single update call may run. Time beyond this is dropped, so one slow frame
+     * cannot snowball into slower and slower frames.
+     */
+    void setFixedRate(uint hz, uint maxSubsteps = PHYS_DEFAULT_MAX_SUBSTEPS);
+    inline uint getFixedRate() { return fixedHz_; }
+    /**
+     * @brief Switches deterministic stepping on or off. While on, every update call runs exactly one step of 1 / hz
+     * and the frame time is ignored, so two controllers fed the same bodies and the same commands before each update
+     * end up with bit identical state on any number of threads. Takes precedence over setFixedRate, and targets are
+     * left at their simulated positions rather than interpolated ones. Should not be called while the pipeline is
+     * running.
+     * @param hz Steps per second of simulated time, so each update call advances 1 / hz seconds. 0 switches
+     * deterministic mode off.
+     */
+    void setDeterministic(uint hz);
+    inline bool isDeterministic() { return 0 != deterministicHz_; }
+    /**
+     * @brief Hashes the simulated state of every body - handle, position, velocity, acceleration, timers and sleep
+     * state - bit for bit, in body order. Compare hashes from two runs to check a lockstep peer or a replay has not
+     * diverged. Should not be called while the pipeline is running.
+     * @return 64 bit FNV-1a hash of the body state and the step count.
+     */
+    uint64_t getStateHash();
+    // Number of steps run by the most recent update call
+    inline uint getLastSubsteps() { return lastSubsteps_; }
+    // Fraction of a fixed step between the last step and the rendered positions
+    inline float getInterpolationAlpha() { return alpha_; }
     PhysicsResult shutdown();
     inline int hasShutdown() { return shutdown_; }
-    inline const map<string, std::shared_ptr<PhysicsObject>> &getPhysicsObjects() { return physicsObjects_; }
+    // Name lookup layer over the body store - maps SceneObject names to body handles
+    inline const map<string, PhysicsHandle> &getPhysicsObjects() { return bodyNames_; }
+    inline const PhysicsBodyStore &getBodies() { return bodies_; }
+    /**
+     * @brief Selects how candidate pairs are found in the COLLISION stage. This should not be called while the
+     * physics pipeline is running.
+     * @param mode PhysicsBroadphase::SPATIAL_HASH to use the spatial hash, PhysicsBroadphase::BRUTE_FORCE to check
+     * every object against every other object.
+     */
+    void setBroadphase(PhysicsBroadphase mode);
+    inline PhysicsBroadphase getBroadphase() { return broadphaseMode_; }
+    /**
+     * @brief Sets how many passes the contact solver makes after the FINALIZE stage. Each pass moves every body out
+     * of the bodies it is still sinking into, so stacked and crowded bodies settle instead of jittering. This should
+     * not be called while the physics pipeline is running.
+     * @param iterations Passes per step. 0 turns the solver off, leaving only the COLLISION stage's single response.
+     */
+    void setSolverIterations(uint iterations);
+    inline uint getSolverIterations() { return solverIterations_; }
+    /**
+     * @brief Sets the cell size used by the spatial hash broadphase. Cells should be roughly the size of the
+     * common moving object.
+     * @param cellSize Edge length of a broadphase cell in world units.
+     */
+    void setBroadphaseCellSize(float cellSize);
+    /**
+     * @brief Fetches how long each pipeline stage took during the most recent update call, summed over every step the
+     * call ran. Only meaningful on the thread driving update.
+     * @return PhysicsStageTiming containing the position, collision and finalize stage times.
+     */
+    inline PhysicsStageTiming getStageTiming() { return stageTiming_; }
+    /**
+     * @brief Fetches the counters gathered during the most recent update call. Safe to call from any thread. The job
+     * system counters cover every job that ran during the update, including other systems' jobs on a shared job
+     * system.
+     * @return Snapshot of the stats published at the end of the last update. All zero before the first update.
+     */
+    PhysicsStats getStats();
     ~PhysicsController();
     static uint getDefaultThreadSize();
 
  private:
-    std::atomic<uint> threadNum_;
+    /**
+     * @brief Runs the motion formula for a range of bodies and stores each body's new simulated position.
+     * @param begin First active list entry to update.
+     * @param end One past the last active list entry to update.
+     */
+    void updatePositions(uint begin, uint end);
+    /**
+     * @brief Checks a body against a list of potential colliders and accumulates the resulting position and
+     * velocity deltas. Only kinematic bodies are updated, and a body only ever writes to its own state. The body's
+     * contact cache is rebuilt from the candidates - pairs that were touching last step are pushed apart along their
+     * cached normal, and pairs the broadphase no longer returns are dropped.
+     * @param index Body to update.
+     * @param candidates Body indices to test against, as produced by the broadphase. May contain index.
+     * @param scratch Calling thread's scratch buffers.
+     */
+    void updateCollision(uint index, const vector<uint> &candidates, CollisionScratch *scratch);
+    /**
+     * @brief Appends a box to the candidates tested by updateCollision.
+     * @param other Body the box belongs to.
+     * @param center Center of the box at the body's current position.
+     * @param offset Half extents of the box.
+     * @param prevCenter Center of the box before the POSITION stage.
+     * @param triangle First corner of the box's triangle in scratch->corners, or PHYS_INVALID_INDEX.
+     * @param scratch Calling thread's scratch buffers.
+     */
+    void addCandidate(uint other, const vec3 &center, const vec3 &offset, const vec3 &prevCenter, uint triangle,
+        CollisionScratch *scratch);
+    /**
+     * @brief Adds every triangle of a mesh body near a region as its own candidate box.
+     * @param other Mesh body.
+     * @param minBound Minimum corner of the region in world space.
+     * @param maxBound Maximum corner of the region in world space.
+     * @param scratch Calling thread's scratch buffers.
+     */
+    void gatherMeshTriangles(uint other, const vec3 &minBound, const vec3 &maxBound, CollisionScratch *scratch);
+    // Scale applied to a mesh body's model space triangles
+    vec3 meshScale(uint index);
+    /**
+     * @brief Finds the collision candidates for a body and runs its collision checks.
+     * @param index Body to update.
+     * @param scratch Calling thread's scratch buffers.
+     */
+    void collideBody(uint index, CollisionScratch *scratch);
+    /**
+     * @brief Queues a sleeping body to be woken once the COLLISION stage finishes. Safe to call from workers.
+     * @param index Body that was touched.
+     */
+    void requestWake(uint index);
+    /**
+     * @brief Wakes every body touched during the COLLISION stage and runs their collision checks, repeating until
+     * no more bodies are woken. This wakes the whole group of bodies touching each other in the same step.
+     */
+    void wakeTouchedBodies();
+    /**
+     * @brief Applies the position and velocity deltas accumulated in the COLLISION stage, and counts how long the
+     * body has been at rest.
+     * @param index Body to update.
+     */
+    void updateFinalize(uint index);
+    /**
+     * @brief Merges the contact pairs every worker found during the COLLISION stage, compares them with the pairs
+     * found last step and queues the resulting events for the next sync to deliver.
+     */
+    void submitContacts();
+    /**
+     * @brief Moves the contact pairs found by a COLLISION or WAKE batch into the step's contact list.
+     * @param contacts The calling thread's contact buffer. Cleared on return.
+     */
+    void mergeContacts(vector<uint64_t> *contacts);
+    /**
+     * @brief Moves the bodies a COLLISION or WAKE batch found solver contacts for into the step's solver body list.
+     * @param solverBodies The calling thread's solver body buffer. Cleared on return.
+     */
+    void mergeSolverBodies(vector<uint> *solverBodies);
+    /**
+     * @brief Runs the contact solver over the contacts found this step. Each pass is a Jacobi iteration split into two
+     * stages: SOLVE works out every body's correction from the current positions, then CORRECT applies them. A body
+     * only writes its own state in either stage, so batches never need a lock. Stops early once a pass moves nothing.
+     */
+    void solveContacts();
+    /**
+     * @brief Works out how far a body has to move to stop sinking into the bodies it touched this step, and stores it
+     * in the body's positionDelta.
+     * @param entry Entry of solverBodies_ to solve.
+     * @param warm True on the first pass of a step. Each contact starts from the share of the overlap the body covered
+     * last step, and its cached normal and penetration are refreshed.
+     * @return true when the body has to move.
+     */
+    bool solveBody(uint entry, bool warm);
+    /**
+     * @brief Moves a body by the correction found by solveBody, stops any velocity pushing it back in and adds the
+     * move to each contact's accumulated distance.
+     * @param index Body to update.
+     */
+    void applyCorrection(uint index);
+    /**
+     * @brief Puts every body that has been at rest for PHYS_SLEEP_FRAMES steps to sleep. Requires an exclusive lock
+     * on physicsObjectQueueLock_.
+     */
+    void updateSleepStates();
+    /**
+     * @brief Rebuilds the spatial hash of sleeping bodies when the sleeping set has changed. Sleeping bodies do not
+     * move, so their hash is kept across steps. Requires an exclusive lock on physicsObjectQueueLock_.
+     */
+    void buildSleepingBroadphase();
+    /**
+     * @brief Stores the collider box of a body at its simulated position.
+     * @param index Body to update.
+     * @param minBound Output minimum corner of the collider.
+     * @param maxBound Output maximum corner of the collider.
+     */
+    void updateBodyBounds(uint index, vec3 *minBound, vec3 *maxBound);
+    /**
+     * @brief Runs the POSITION, COLLISION and FINALIZE stages once, advancing every body by stepTime_.
+     */
+    void step();
+    /**
+     * @brief Runs adoptTargetPosition over a range of the body store, asking to wake any sleeping body that moved.
+     * @param begin First body to check.
+     * @param end One past the last body to check.
+     */
+    void adoptTargetPositions(uint begin, uint end);
+    /**
+     * @brief Picks up a target moved outside of the controller since it was last published, so the body continues
+     * from the new position instead of snapping back.
+     * @param index Body to check.
+     * @return true when the target had moved.
+     */
+    bool adoptTargetPosition(uint index);
+    /**
+     * @brief Runs publishTarget over a range of the active list.
+     */
+    void publishTargets(uint begin, uint end);
+    /**
+     * @brief Moves a body's target to its simulated position, or to a position alpha_ of the way between its last
+     * two steps while interpolating, and brings its matrices and collider up to date.
+     * @param index Body to publish.
+     */
+    void publishTarget(uint index);
+    /**
+     * @brief Fetches the simulated position of a body. The target only reaches it once the step is published.
+     */
+    vec3 physicsPosition(uint index);
+    /**
+     * @brief Resets the reference position to the body's real position to allow the runningTime counter to be reset
+     * without moving the body backwards.
+     */
+    void flushPosition(uint index);
+    /**
+     * @brief Updates the reference velocity to velocity + acceleration * runningTime to maintain momentum of bodies
+     * before a runningTime reset.
+     */
+    void flushVelocity(uint index);
+    /**
+     * @brief Runs position and velocity flushes and resets the runningTime counter back to zero.
+     */
+    void fullFlush(uint index);
+    /**
+     * @brief Applies a change to a single body. Requires an exclusive lock on physicsObjectQueueLock_.
+     * @param index Body to change.
+     * @param command Change to apply. The command's handle is ignored.
+     */
+    void applyCommand(uint index, const PhysicsCommand &command);
+    /**
+     * @brief Looks up a body by name and queues a change to it, like the handle overloads do.
+     * @param objectName SceneObject to change.
+     * @param command Change to queue. The command's handle is replaced with the handle of the named body.
+     * @return PhysicsResult::OK when the object is discovered, PhysicsResult::FAILURE otherwise.
+     */
+    PhysicsResult applyNamedCommand(const string &objectName, PhysicsCommand command);
+    /**
+     * @brief Queues a change for the next update call. When the queue is full the change is spilled into
+     * spilledCommands_, and every later change follows it there until the next update drains both, so nothing is
+     * dropped or reordered and the caller never waits on an update in flight.
+     * @param command Change to queue.
+     * @return PhysicsResult::OK
+     */
+    PhysicsResult queueCommand(const PhysicsCommand &command);
+    /**
+     * @brief Applies every queued change in order, then every spilled change. Requires an exclusive lock on
+     * physicsObjectQueueLock_.
+     */
+    void applyQueuedCommands();
+    /**
+     * @brief Adds the bodies added since the last update to the store, then removes the bodies they replace.
+     * Requires an exclusive lock on physicsObjectQueueLock_, and no update in flight.
+     */
+    void applyPendingBodies();
+    /**
+     * @brief Removes a body from the store and clears its target out of the reports waiting for sync. Requires
+     * updateLock_ and an exclusive lock on physicsObjectQueueLock_, with no update in flight.
+     * @param handle Body to remove. Does nothing when the handle does not refer to a body in the store.
+     */
+    void removeBody(PhysicsHandle handle);
+    /**
+     * @brief Rebuilds the collision body list and spatial hash of awake bodies from the positions produced by the
+     * POSITION stage. Requires an exclusive lock on physicsObjectQueueLock_.
+     */
+    void buildBroadphase();
+    /**
+     * @brief Fetches the collision candidates for a single body from the awake and sleeping spatial hashes.
+     * @param index Body to find candidates for.
+     * @param scratch Calling thread's scratch buffers. Candidates are written to scratch->candidates in ascending
+     * body order.
+     */
+    void collectCandidates(uint index, CollisionScratch *scratch);
+    /**
+     * @brief Splits the awake bodies into one contiguous batch per job system worker and submits them as a parallel
+     * for. Requires an exclusive lock on physicsObjectQueueLock_.
+     * @param workType Pipeline stage to run on each batch.
+     */
+    void scheduleBatches(PhysicsWorkType workType);
+    /**
+     * @brief Runs a pipeline stage on a contiguous range of the active list (or of the woken list for WAKE, or of the
+     * solver body list for SOLVE and CORRECT). Called from job system workers.
+     * @param workType Pipeline stage to run.
+     * @param begin First list entry to process.
+     * @param end One past the last list entry to process.
+     */
+    void runBatch(PhysicsWorkType workType, uint begin, uint end);
+    /**
+     * @brief Copies every collider box into a new PhysicsQueryWorld and publishes it for the scene queries. Called
+     * after the last step of an update, from the simulated positions.
+     */
+    void publishQueryWorld();
+    /**
+     * @brief Adds a batch's pair and contact counts to the update's totals and clears them.
+     * @param scratch The calling thread's scratch buffers.
+     */
+    void flushCounters(CollisionScratch *scratch);
+    /**
+     * @brief Gathers the counters for the update that just finished and publishes them for getStats.
+     * @param jobsBefore Job system counters taken at the start of the update.
+     */
+    void publishStats(const JobSystemStats &jobsBefore);
+    std::unique_ptr<JobSystem> ownedJobSystem_;  // Only set when the controller was not given a job system
+    JobSystem *jobSystem_;
+    JobHandle stageJob_;  // Completes when every batch of the most recently scheduled stage has run
+    JobHandle updateJob_;  // Completes when the steps started by updateAsync have run
+    // Held by the thread starting, landing or reconfiguring an update. Never taken by the update job itself.
+    std::mutex updateLock_;
+    JobSystemStats jobsBefore_;  // Job system counters taken when the update in flight started
     int shutdown_ = 0;
-    std::vector<std::thread> threads_;
     std::shared_mutex physicsObjectQueueLock_;
     std::mutex subscriberLock_;
-    std::mutex workQueueLock_;
-    std::atomic<uint> freeWorkers_;
-    map<string, std::shared_ptr<PhysicsObject>> physicsObjects_;
-    queue<std::shared_ptr<PhysicsObject>> workQueue_;
+    PhysicsBodyStore bodies_;
+    std::mutex pendingBodyLock_;  // Guards bodyNames_, pendingAdds_ and pendingRemoves_
+    map<string, PhysicsHandle> bodyNames_;  // Includes bodies still waiting in pendingAdds_
+    vector<PhysicsPendingAdd> pendingAdds_;  // Bodies to add at the start of the next update, in call order
+    vector<PhysicsHandle> pendingRemoves_;  // Bodies replaced by a re-add, removed after pendingAdds_ land
+    PhysicsCommandQueue commandQueue_;  // Changes made through handles, applied at the start of each update
+    std::mutex spillLock_;
+    vector<PhysicsCommand> spilledCommands_;  // Changes made while commandQueue_ was full, applied after it
+    std::atomic<bool> commandsSpilled_ { false };  // Set while spilledCommands_ holds changes
+    PhysicsBroadphase broadphaseMode_ = PhysicsBroadphase::SPATIAL_HASH;
+    SpatialHash broadphase_;
+    vector<uint> collisionBodies_;  // Awake bodies with colliders in ascending order, indexed by broadphase_
+    SpatialHash sleepingBroadphase_;
+    vector<uint> sleepingCollisionBodies_;  // Sleeping bodies with colliders, indexed by sleepingBroadphase_
+    vector<uint> allCollisionBodies_;  // Every body with a collider in ascending order, for BRUTE_FORCE
+    uint sleepingBroadphaseVersion_ = UINT_MAX;  // Body store sleep version the sleeping hash was built for
+    std::mutex wakeLock_;
+    vector<uint> wakeRequests_;  // Sleeping bodies touched during the COLLISION stage
+    vector<uint> wokenBodies_;  // Bodies being processed by the WAKE stage
+    PhysicsStageTiming stageTiming_;
+    uint fixedHz_ = 0;  // 0 when stepping once per update call
+    uint deterministicHz_ = 0;  // 0 unless every update call runs exactly one step of this rate
+    uint maxSubsteps_ = PHYS_DEFAULT_MAX_SUBSTEPS;
+    double accumulator_ = 0.0;  // Frame time not yet consumed by fixed steps
+    float stepTime_ = 0.0f;  // Time advanced by the step currently running
+    double frameDeltaTime_ = 0.0;  // Scaled delta time of the frame passed to the last updateAsync call
+    float alpha_ = 0.0f;
+    uint lastSubsteps_ = 0;
+    bool interpolated_ = false;  // True while targets are published at interpolated render positions
+    vector<PhysicsHandle> settledBodies_;  // Bodies put to sleep since the last sync, published along with the rest
     vector<PhysicsSubscriber> subscribers_;
-    std::condition_variable workAvailableSignal_;
-    std::condition_variable workCompletedSignal_;
+    bool recordContacts_ = false;  // Set for each step when there is at least one subscriber
+    std::mutex contactLock_;
+    vector<uint64_t> stepContacts_;  // Contact pairs found this step, packed as (lower handle << 32) | higher handle
+    vector<uint64_t> previousContacts_;  // Sorted contact pairs found last step
+    vector<PhysicsReport> pendingReports_;  // Reports of the steps since the last sync, delivered by sync
+    uint solverIterations_ = PHYS_DEFAULT_SOLVER_ITERATIONS;
+    uint solverPass_ = 0;  // Pass the contact solver is running
+    std::mutex solverLock_;
+    vector<uint> solverBodies_;  // Bodies with touching box contacts in their contact cache this step
+    std::atomic<bool> solverMoved_ { false };  // Set by any SOLVE batch that found a body to move
+    uint64_t stepCount_ = 0;
+    std::atomic<uint64_t> pairsTested_ { 0 };  // Counters for the update call in progress
+    std::atomic<uint64_t> contactsFound_ { 0 };
+    uint64_t solverPasses_ = 0;
+    std::mutex statsLock_;  // Only held to copy or replace stats_
+    PhysicsStats stats_;
+    std::mutex queryWorldLock_;  // Only held to copy or swap queryWorld_, never while a query runs
+    std::shared_ptr<const PhysicsQueryWorld> queryWorld_;
 };
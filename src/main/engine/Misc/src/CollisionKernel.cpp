@@ -0,0 +1,177 @@
+/**
+ * @file CollisionKernel.cpp
+ * @author Alec Jackson
+ * @brief Batched AABB overlap tests for the physics collision stage
+ * @version 0.1
+ * @date 2025
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#include <CollisionKernel.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#if defined(PHYS_SIMD_AVX)
+#include <immintrin.h>
+#elif defined(PHYS_SIMD_SSE2)
+#include <emmintrin.h>
+#endif
+
+void aabbOverlapBatchScalar(const vec3 &minBound, const vec3 &maxBound, const AabbBatch &batch, uint begin,
+    uint end, uint8_t *masks) {
+    // Fold the tolerance into the tested box once instead of once per pair
+    vec3 lo = minBound + vec3(PHYS_COLLISION_EPSILON);
+    vec3 hi = maxBound - vec3(PHYS_COLLISION_EPSILON);
+    for (uint i = begin; i < end; ++i) {
+        int matching = NO_MATCH;
+        if (lo.x < batch.maxX[i] && batch.minX[i] < hi.x) matching |= X_MATCH;
+        if (lo.y < batch.maxY[i] && batch.minY[i] < hi.y) matching |= Y_MATCH;
+        if (lo.z < batch.maxZ[i] && batch.minZ[i] < hi.z) matching |= Z_MATCH;
+        masks[i - begin] = static_cast<uint8_t>(matching);
+    }
+}
+
+#if defined(PHYS_SIMD_SSE2) || defined(PHYS_SIMD_AVX)
+// Packs four 32 bit lane masks into four bytes
+static inline void storeMasks(__m128i lanes, uint8_t *masks) {
+    auto packed = _mm_packus_epi16(_mm_packs_epi32(lanes, lanes), _mm_setzero_si128());
+    int32_t bytes = _mm_cvtsi128_si32(packed);
+    memcpy(masks, &bytes, sizeof(bytes));
+}
+#endif
+
+#if defined(PHYS_SIMD_AVX)
+void aabbOverlapBatch(const vec3 &minBound, const vec3 &maxBound, const AabbBatch &batch, uint begin, uint end,
+    uint8_t *masks) {
+    vec3 lo = minBound + vec3(PHYS_COLLISION_EPSILON);
+    vec3 hi = maxBound - vec3(PHYS_COLLISION_EPSILON);
+    auto loX = _mm256_set1_ps(lo.x), loY = _mm256_set1_ps(lo.y), loZ = _mm256_set1_ps(lo.z);
+    auto hiX = _mm256_set1_ps(hi.x), hiY = _mm256_set1_ps(hi.y), hiZ = _mm256_set1_ps(hi.z);
+    auto bitX = _mm256_castsi256_ps(_mm256_set1_epi32(X_MATCH));
+    auto bitY = _mm256_castsi256_ps(_mm256_set1_epi32(Y_MATCH));
+    auto bitZ = _mm256_castsi256_ps(_mm256_set1_epi32(Z_MATCH));
+    uint i = begin;
+    for (; i + 8 <= end; i += 8) {
+        auto x = _mm256_and_ps(_mm256_cmp_ps(loX, _mm256_loadu_ps(&batch.maxX[i]), _CMP_LT_OQ),
+            _mm256_cmp_ps(_mm256_loadu_ps(&batch.minX[i]), hiX, _CMP_LT_OQ));
+        auto y = _mm256_and_ps(_mm256_cmp_ps(loY, _mm256_loadu_ps(&batch.maxY[i]), _CMP_LT_OQ),
+            _mm256_cmp_ps(_mm256_loadu_ps(&batch.minY[i]), hiY, _CMP_LT_OQ));
+        auto z = _mm256_and_ps(_mm256_cmp_ps(loZ, _mm256_loadu_ps(&batch.maxZ[i]), _CMP_LT_OQ),
+            _mm256_cmp_ps(_mm256_loadu_ps(&batch.minZ[i]), hiZ, _CMP_LT_OQ));
+        auto lanes = _mm256_or_ps(_mm256_or_ps(_mm256_and_ps(x, bitX), _mm256_and_ps(y, bitY)),
+            _mm256_and_ps(z, bitZ));
+        storeMasks(_mm_castps_si128(_mm256_castps256_ps128(lanes)), masks + (i - begin));
+        storeMasks(_mm_castps_si128(_mm256_extractf128_ps(lanes, 1)), masks + (i - begin) + 4);
+    }
+    aabbOverlapBatchScalar(minBound, maxBound, batch, i, end, masks + (i - begin));
+}
+#elif defined(PHYS_SIMD_SSE2)
+void aabbOverlapBatch(const vec3 &minBound, const vec3 &maxBound, const AabbBatch &batch, uint begin, uint end,
+    uint8_t *masks) {
+    vec3 lo = minBound + vec3(PHYS_COLLISION_EPSILON);
+    vec3 hi = maxBound - vec3(PHYS_COLLISION_EPSILON);
+    auto loX = _mm_set1_ps(lo.x), loY = _mm_set1_ps(lo.y), loZ = _mm_set1_ps(lo.z);
+    auto hiX = _mm_set1_ps(hi.x), hiY = _mm_set1_ps(hi.y), hiZ = _mm_set1_ps(hi.z);
+    auto bitX = _mm_set1_epi32(X_MATCH), bitY = _mm_set1_epi32(Y_MATCH), bitZ = _mm_set1_epi32(Z_MATCH);
+    uint i = begin;
+    for (; i + 4 <= end; i += 4) {
+        auto x = _mm_and_ps(_mm_cmplt_ps(loX, _mm_loadu_ps(&batch.maxX[i])),
+            _mm_cmplt_ps(_mm_loadu_ps(&batch.minX[i]), hiX));
+        auto y = _mm_and_ps(_mm_cmplt_ps(loY, _mm_loadu_ps(&batch.maxY[i])),
+            _mm_cmplt_ps(_mm_loadu_ps(&batch.minY[i]), hiY));
+        auto z = _mm_and_ps(_mm_cmplt_ps(loZ, _mm_loadu_ps(&batch.maxZ[i])),
+            _mm_cmplt_ps(_mm_loadu_ps(&batch.minZ[i]), hiZ));
+        auto lanes = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_castps_si128(x), bitX),
+            _mm_and_si128(_mm_castps_si128(y), bitY)), _mm_and_si128(_mm_castps_si128(z), bitZ));
+        storeMasks(lanes, masks + (i - begin));
+    }
+    aabbOverlapBatchScalar(minBound, maxBound, batch, i, end, masks + (i - begin));
+}
+#else
+void aabbOverlapBatch(const vec3 &minBound, const vec3 &maxBound, const AabbBatch &batch, uint begin, uint end,
+    uint8_t *masks) {
+    aabbOverlapBatchScalar(minBound, maxBound, batch, begin, end, masks);
+}
+#endif
+
+float aabbSweep(const vec3 &center, const vec3 &offset, const vec3 &motion, const vec3 &otherCenter,
+    const vec3 &otherOffset, float skin) {
+    // Shrink the problem to a point moving through the other box grown by the moving box's extents
+    auto range = glm::abs(offset) + glm::abs(otherOffset) - vec3(skin);
+    float enter = 0.0f;
+    float exit = 1.0f;
+    for (int i = 0; i < 3; ++i) {
+        auto lo = otherCenter[i] - range[i];
+        auto hi = otherCenter[i] + range[i];
+        // Boxes thinner than the skin together can never overlap by it
+        if (range[i] <= 0.0f) return PHYS_SWEEP_MISS;
+        if (motion[i] == 0.0f) {
+            // Not moving on this axis, so the boxes have to overlap on it for the whole sweep
+            if (center[i] <= lo || center[i] >= hi) return PHYS_SWEEP_MISS;
+            continue;
+        }
+        auto tLo = (lo - center[i]) / motion[i];
+        auto tHi = (hi - center[i]) / motion[i];
+        if (tLo > tHi) std::swap(tLo, tHi);
+        enter = std::max(enter, tLo);
+        exit = std::min(exit, tHi);
+        if (enter > exit) return PHYS_SWEEP_MISS;
+    }
+    return enter;
+}
+
+vec3 aabbEdgePoint(const vec3 &center1, const vec3 &offset1, const vec3 &center2, const vec3 &offset2,
+    const vec3 &epSign) {
+    auto deltaBase = center1 - center2;
+    auto range = offset1 + offset2;
+    vec3 edgePoint = range - glm::abs(deltaBase);
+    for (int i = 0; i < 3; ++i) {
+        // The first box moved past the center of the second box this update, so push it out the far side
+        if ((epSign[i] > 0.0f && deltaBase[i] < 0.0f) ||
+            (epSign[i] < 0.0f && deltaBase[i] > 0.0f)) {
+            edgePoint[i] = (2 * range[i]) - edgePoint[i];
+        }
+    }
+    return edgePoint;
+}
+
+vec3 aabbEdgePointPosInf(const vec3 &center1, const vec3 &offset1, const vec3 &center2, const vec3 &offset2) {
+    auto deltaBase = center1 - center2;
+    vec3 edgePoint = (offset1 + offset2) - glm::abs(deltaBase);
+    float highestDistance = std::max(std::abs(deltaBase.x), std::max(std::abs(deltaBase.y), std::abs(deltaBase.z)));
+    if (highestDistance == 0.0f) return vec3(0.0f);
+    return edgePoint * (deltaBase / vec3(highestDistance));
+}
+
+bool aabbTriangleOverlap(const vec3 &center, const vec3 &offset, const vec3 &v0, const vec3 &v1, const vec3 &v2) {
+    // Work relative to the box center, so the box spans [-offset, offset]
+    auto extents = glm::abs(offset);
+    vec3 corners[3] = { v0 - center, v1 - center, v2 - center };
+    vec3 edges[3] = { corners[1] - corners[0], corners[2] - corners[1], corners[0] - corners[2] };
+    // Projects the triangle and box onto axis and reports whether they are separated on it
+    auto separated = [&](const vec3 &axis) {
+        auto p0 = glm::dot(corners[0], axis);
+        auto p1 = glm::dot(corners[1], axis);
+        auto p2 = glm::dot(corners[2], axis);
+        auto radius = glm::dot(extents, glm::abs(axis));
+        return std::min(p0, std::min(p1, p2)) > radius || std::max(p0, std::max(p1, p2)) < -radius;
+    };
+    // The three box face normals, which is the same as comparing bounds
+    for (int i = 0; i < 3; ++i) {
+        vec3 axis(0.0f);
+        axis[i] = 1.0f;
+        if (separated(axis)) return false;
+    }
+    // The triangle's face normal
+    if (separated(glm::cross(edges[0], edges[1]))) return false;
+    // Every box axis crossed with every triangle edge. Parallel pairs give a zero axis, which never separates.
+    for (int i = 0; i < 3; ++i) {
+        vec3 boxAxis(0.0f);
+        boxAxis[i] = 1.0f;
+        for (auto &edge : edges) {
+            if (separated(glm::cross(boxAxis, edge))) return false;
+        }
+    }
+    return true;
+}
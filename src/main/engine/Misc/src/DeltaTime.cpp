@@ -7,4 +7,6 @@
  */
 
 /* Source file used instead of a header file to avoid duplicate symbol errors. */
+/* Deprecated - kept for the update() overloads that take no FrameContext. The GameInstance hands every subsystem a
+ * FrameContext, and only writes the real frame time here at the end of each update as a mirror for old callers. */
 double deltaTime = 0.0f;
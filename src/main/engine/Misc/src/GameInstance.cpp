@@ -30,6 +30,8 @@
 #include <TPSCameraObject.hpp>
 
 std::unique_ptr<GfxController> gfxController;
+// Declared before the controllers so it is destroyed after them - they submit work to it
+std::unique_ptr<JobSystem> jobSystem;
 std::unique_ptr<AnimationController> animationController;
 std::unique_ptr<PhysicsController> physicsController;
 std::unique_ptr <InputController> inputController;
@@ -552,18 +554,52 @@ int GameInstance::update() {
     Uint64 begin, end;
     begin = SDL_GetPerformanceCounter();
     int error = 0;
-    error = updateObjects();
-    error |= updateWindow();
+    // Every subsystem is handed the same copy, so nothing reads the time while it is being advanced below
+    auto frame = getFrameContext();
+    // Land the physics step started last frame, so input and animations see where it left everything
+    physicsController_->sync();
     updateInput();
     inputController->update();
-    animationController_->update();
-    physicsController_->update();
+    animationController_->update(frame);
+    // The next step only touches the physics body store, so it runs while this frame renders
+    physicsController_->updateAsync(frame);
+    error = updateObjects();
+    error |= updateWindow();
     std::this_thread::yield();
     end = SDL_GetPerformanceCounter();
-    deltaTime = static_cast<double>(end - begin) / (SDL_GetPerformanceFrequency());
+    auto fixedHz = physicsController_->getFixedRate();
+    std::unique_lock<std::mutex> scopeLock(frameLock_);
+    frame_ = frame_.next(static_cast<double>(end - begin) / (SDL_GetPerformanceFrequency()), paused_ ? 0.0 : timeScale_,
+        fixedHz ? 1.0 / fixedHz : 0.0);
+    deltaTime = frame_.realDeltaTime;
     return error;
 }
 
+FrameContext GameInstance::getFrameContext() {
+    std::unique_lock<std::mutex> scopeLock(frameLock_);
+    return frame_;
+}
+
+void GameInstance::setTimeScale(double timeScale) {
+    std::unique_lock<std::mutex> scopeLock(frameLock_);
+    timeScale_ = timeScale;
+}
+
+double GameInstance::getTimeScale() {
+    std::unique_lock<std::mutex> scopeLock(frameLock_);
+    return timeScale_;
+}
+
+void GameInstance::setPaused(bool paused) {
+    std::unique_lock<std::mutex> scopeLock(frameLock_);
+    paused_ = paused;
+}
+
+bool GameInstance::isPaused() {
+    std::unique_lock<std::mutex> scopeLock(frameLock_);
+    return paused_;
+}
+
 int GameInstance::removeSceneObject(string objectName) {
     std::unique_lock<std::mutex> lock(sceneLock_);
     removeSceneObject_(objectName);
@@ -743,20 +779,29 @@ void GameInstance::processConfig(const StudiousConfig &config) {
     auto cfgWidth = config.getIField("resX");
     auto cfgHeight = config.getIField("resY");
     auto cfgVsync = config.getIField("enableVsync");
+    auto cfgJobThreads = config.getUField("jobThreads");
     auto cfgPhysThreads = config.getUField("physThreads");
+    auto cfgPhysHz = config.getUField("physHz");
+    auto cfgPhysMaxSubsteps = config.getUField("physMaxSubsteps");
     auto cfgGfx = config.getSField("gfx");
     auto cfgAaSamples = config.getUField("AASamples");
+    auto cfgGfxDebug = config.getIField("gfxDebug");
     aasamples_ = cfgAaSamples.success() ? cfgAaSamples.data : DEFAULT_AASAMPLES;
     width_ = cfgWidth.success() ? cfgWidth.data : DEFAULT_WIDTH;
     height_ = cfgHeight.success() ? cfgHeight.data : DEFAULT_HEIGHT;
     vsync_ = cfgVsync.success() ? cfgVsync.data : DEFAULT_VSYNC;
-    uint physThreads = cfgPhysThreads.success() ? cfgPhysThreads.data : PhysicsController::getDefaultThreadSize();
+    // physThreads is still honored for older configs now that physics shares the job system
+    uint jobThreads = cfgJobThreads.success() ? cfgJobThreads.data :
+        cfgPhysThreads.success() ? cfgPhysThreads.data : JobSystem::getDefaultThreadSize();
     string gfxBackend = cfgGfx.success() ? cfgGfx.data : DEFAULT_GFX;
+    // gfxDebug=1 checks for errors after every gfx call, 0 checks once per frame
+    auto gfxErrorMode = !cfgGfxDebug.success() ? GFX_DEFAULT_ERROR_MODE :
+        cfgGfxDebug.data ? GfxErrorMode::IMMEDIATE : GfxErrorMode::DEFERRED;
 
     // Load in controllers based on settings
     if (gfxBackend.compare(GFX_OPENGL_CFG_STRING) == 0) {
         printf("GameInstance::processConfig: Detected OpenGL\n");
-        gfxController = std::make_unique<OpenGlGfxController>();
+        gfxController = std::make_unique<OpenGlGfxController>(gfxErrorMode);
     } else if (gfxBackend.compare(GFX_VULKAN_CFG_STRING) == 0) {
         printf("GameInstance::processConfig: Detected Vulkan\n");
         fprintf(stderr, "GameInstance::processConfig: ERROR! Vulkan not yet supported\n");
@@ -764,11 +809,16 @@ void GameInstance::processConfig(const StudiousConfig &config) {
     } else {
         printf("GameInstance::processConfig: Unknown gfx backend %s, defaulting to OpenGL\n",
             gfxBackend.c_str());
-        gfxController = std::make_unique<OpenGlGfxController>();
+        gfxController = std::make_unique<OpenGlGfxController>(gfxErrorMode);
     }
 
+    jobSystem = std::make_unique<JobSystem>(jobThreads);
     animationController = std::make_unique<AnimationController>();
-    physicsController = std::make_unique<PhysicsController>(physThreads);
+    animationController->setJobSystem(jobSystem.get());
+    physicsController = std::make_unique<PhysicsController>(jobSystem.get());
+    // Physics runs once per frame unless a fixed simulation rate is configured
+    physicsController->setFixedRate(cfgPhysHz.success() ? cfgPhysHz.data : 0,
+        cfgPhysMaxSubsteps.success() ? cfgPhysMaxSubsteps.data : PHYS_DEFAULT_MAX_SUBSTEPS);
     inputController = std::make_unique<InputController>(cameras_, &cameraLock_);
 
     // Populate internal pointers to keep things easy
@@ -67,6 +67,7 @@ void GameScene::update(CameraObject *camera) {
     auto perspectiveMat = camera->getPerspective();
     auto orthoMat = camera->getOrthographic();
     auto orthoMatBase = camera->getOrthographicBase();
+    renderQueue_.clear();
     for (auto &obj : renderPriorityMap_) {
         // Send the current screen res to each object
         /// @todo Maybe use a global variable for resolution?
@@ -92,10 +93,47 @@ void GameScene::update(CameraObject *camera) {
                         objPtr->type());
                     break;
             }
-            // Render the object -> the map iterator will sort keys automatically
-            objPtr->update();
+            renderQueue_.push(objPtr->renderPacket(renderQueue_.size()));
         }
     }
+    // Priority is the top of each key, so sorting keeps priority order. Within a priority opaque objects are grouped by
+    // shared state, while 2D objects keep painter's order
+    renderQueue_.sort();
+    auto &packets = renderQueue_.packets();
+    for (size_t i = 0; i < packets.size();) {
+        // GameObjects sharing a Polygon also share a key apart from depth, so instanceable runs are adjacent
+        auto end = i + 1;
+        auto type = packets[i].object->type();
+        if (type == GAME_OBJECT) {
+            auto first = static_cast<GameObject *>(packets[i].object);
+            while (end < packets.size() && packets[end].object->type() == GAME_OBJECT &&
+                first->canInstanceWith(*static_cast<GameObject *>(packets[end].object))) {
+                end++;
+            }
+            if (end - i >= GAMEOBJECT_MIN_INSTANCES) {
+                instanceBatch_.clear();
+                for (; i < end; ++i) instanceBatch_.push_back(static_cast<GameObject *>(packets[i].object));
+                GameObject::updateInstanced(instanceBatch_);
+                continue;
+            }
+        } else if (type == SPRITE_OBJECT || type == UI_OBJECT) {
+            // Only sprites that are adjacent in painter's order are batched. The batch merges consecutive objects
+            // sharing a texture into one draw, so overlapping sprites keep their layering
+            auto first = static_cast<GameObject2D *>(packets[i].object);
+            while (end < packets.size() && packets[end].object->type() == type &&
+                first->canBatchWith(*static_cast<GameObject2D *>(packets[end].object))) {
+                end++;
+            }
+            if (end - i >= GAMEOBJECT2D_MIN_BATCH) {
+                spriteBatchObjects_.clear();
+                for (; i < end; ++i) spriteBatchObjects_.push_back(static_cast<GameObject2D *>(packets[i].object));
+                GameObject2D::updateBatched(spriteBatchObjects_, &spriteBatch_);
+                continue;
+            }
+        }
+        for (; i < end; ++i) packets[i].object->update();
+    }
+    renderQueue_.clear();
 }
 
 void GameScene::resetRenderPriorityMap() {
@@ -51,8 +51,6 @@ std::map<Uint8, GameInput> hatInputMap = {
     { SDL_HAT_RIGHT, GameInput::EAST }
 };
 
-#define INVERT_MODIFIER(flag) if (flag) modifier *= -1.0f
-#define TRACK_TRANSFORM TRACKING_SPEED * modifier * deltaTime
 #define MOUSE_DIVISOR 600.0f
 #define STICK_DIVISOR 300.0f
 
@@ -0,0 +1,255 @@
+/**
+ * @file JobSystem.cpp
+ * @author Alec Jackson
+ * @brief Engine wide work-stealing job scheduler shared by physics, animation and asset loading
+ * @version 0.1
+ * @date 2025
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#include <JobSystem.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <iterator>
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+// Nanoseconds since a point in time, for the stats counters
+static inline uint64_t nanosSince(std::chrono::steady_clock::time_point start) {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start).count());
+}
+
+// Lets a worker find its own deque without a lookup - a thread only ever works for one job system
+thread_local JobSystem *tlsJobSystem = nullptr;
+thread_local int tlsQueueIndex = -1;
+
+JobSystem::JobSystem(uint threadNum) : threadNum_ { std::min<uint>(threadNum, JOB_MAX_THREADS) } {
+    printf("JobSystem::JobSystem: Creating with %u threads\n", threadNum_);
+    // Keep at least one queue so jobs have somewhere to go when there are no workers
+    auto queueCount = std::max<uint>(threadNum_, 1);
+    for (uint i = 0; i < queueCount; ++i) {
+        queues_.push_back(std::make_unique<WorkerQueue>());
+    }
+    for (uint i = 0; i < threadNum_; ++i) {
+        threads_.emplace_back(&JobSystem::workerLoop, this, i);
+    }
+}
+
+JobSystem::~JobSystem() {
+    {
+        std::unique_lock<std::mutex> scopeLock(sleepLock_);
+        shutdown_ = true;
+    }
+    workAvailableSignal_.notify_all();
+    jobCompletedSignal_.notify_all();
+    int tCount = 0;
+    for (auto &thread : threads_) {
+        printf("JobSystem::~JobSystem: Joining worker thread %d\n", tCount++);
+        thread.join();
+    }
+}
+
+int JobSystem::currentQueue() {
+    return (tlsJobSystem == this) ? tlsQueueIndex : -1;
+}
+
+JobHandle JobSystem::submit(JOB_FUNC func, const vector<JobHandle> &dependencies) {
+    auto job = std::make_shared<Job>();
+    job->func = std::move(func);
+    for (auto &dependency : dependencies) {
+        if (!dependency) continue;
+        std::unique_lock<std::mutex> depLock(dependency->lock);
+        if (dependency->complete) continue;
+        job->pendingDependencies += 1;
+        dependency->continuations.push_back(job);
+        job->dependencies.push_back(dependency);
+    }
+    // Release the guard count - schedules the job now if nothing it depends on is still running
+    if (--job->pendingDependencies == 0) schedule(job);
+    return job;
+}
+
+JobHandle JobSystem::parallelFor(uint count, uint batchSize, JOB_RANGE_FUNC func,
+    const vector<JobHandle> &dependencies) {
+    if (0 == batchSize) {
+        auto workers = std::max<uint>(threadNum_, 1);
+        batchSize = std::max<uint>((count + workers - 1) / workers, 1);
+    }
+    // Share one copy of the function between all of the ranges
+    auto sharedFunc = std::make_shared<JOB_RANGE_FUNC>(std::move(func));
+    vector<JobHandle> ranges;
+    for (uint begin = 0; begin < count; begin += batchSize) {
+        uint end = std::min(begin + batchSize, count);
+        ranges.push_back(submit([sharedFunc, begin, end]() { (*sharedFunc)(begin, end); }, dependencies));
+    }
+    // Empty job that completes once every range has completed
+    return submit([]() {}, ranges.empty() ? dependencies : ranges);
+}
+
+void JobSystem::schedule(const JobHandle &job) {
+    auto index = currentQueue();
+    if (index < 0) {
+        // Submitted from outside the pool, spread the work across the worker queues
+        index = nextQueue_++ % queues_.size();
+    }
+    job->queuedAt = std::chrono::steady_clock::now();
+    {
+        std::unique_lock<std::mutex> queueLock(queues_[index]->lock);
+        job->queueIndex = index;
+        queues_[index]->jobs.push_back(job);
+    }
+    pendingJobs_ += 1;
+    scheduledJobs_ += 1;
+    {
+        // Taking the sleep lock orders this with a worker checking pendingJobs_ before it sleeps
+        std::unique_lock<std::mutex> scopeLock(sleepLock_);
+    }
+    workAvailableSignal_.notify_one();
+    jobCompletedSignal_.notify_all();
+}
+
+JobHandle JobSystem::findJob() {
+    JobHandle job;
+    auto queueCount = queues_.size();
+    auto own = currentQueue();
+    if (own >= 0) {
+        // Newest work on our own queue first - it is most likely still in cache
+        std::unique_lock<std::mutex> queueLock(queues_[own]->lock);
+        if (!queues_[own]->jobs.empty()) {
+            job = queues_[own]->jobs.back();
+            queues_[own]->jobs.pop_back();
+            job->queueIndex = -1;
+        }
+    }
+    // Steal the oldest work from everyone else
+    uint start = (own >= 0) ? own + 1 : nextQueue_.load();
+    for (uint i = 0; !job && i < queueCount; ++i) {
+        auto &victim = queues_[(start + i) % queueCount];
+        std::unique_lock<std::mutex> queueLock(victim->lock);
+        if (!victim->jobs.empty()) {
+            job = victim->jobs.front();
+            victim->jobs.pop_front();
+            job->queueIndex = -1;
+        }
+    }
+    if (job) pendingJobs_ -= 1;
+    return job;
+}
+
+void JobSystem::execute(const JobHandle &job) {
+    queueWaitNs_.fetch_add(nanosSince(job->queuedAt), std::memory_order_relaxed);
+    {
+        // Everything it depended on has completed, so stop keeping the chain alive
+        std::unique_lock<std::mutex> jobLock(job->lock);
+        job->dependencies.clear();
+    }
+    job->func();
+    jobsRun_.fetch_add(1, std::memory_order_relaxed);
+    vector<JobHandle> continuations;
+    {
+        std::unique_lock<std::mutex> jobLock(job->lock);
+        job->complete = true;
+        continuations.swap(job->continuations);
+    }
+    for (auto &continuation : continuations) {
+        if (--continuation->pendingDependencies == 0) schedule(continuation);
+    }
+    {
+        std::unique_lock<std::mutex> scopeLock(sleepLock_);
+    }
+    jobCompletedSignal_.notify_all();
+}
+
+void JobSystem::workerLoop(uint index) {
+    tlsJobSystem = this;
+    tlsQueueIndex = index;
+    while (1) {
+        auto job = findJob();
+        if (job) {
+            execute(job);
+            continue;
+        }
+        auto idleStart = std::chrono::steady_clock::now();
+        std::unique_lock<std::mutex> scopeLock(sleepLock_);
+        workAvailableSignal_.wait(scopeLock, [this]() { return pendingJobs_ > 0 || shutdown_; });
+        workerIdleNs_.fetch_add(nanosSince(idleStart), std::memory_order_relaxed);
+        if (shutdown_ && pendingJobs_ <= 0) break;
+    }
+    tlsJobSystem = nullptr;
+    tlsQueueIndex = -1;
+}
+
+void JobSystem::collectChain(const JobHandle &job, vector<JobHandle> *chain) {
+    // Dependencies are fixed when a job is submitted, so the chain only has to be walked once per wait
+    std::unordered_set<Job *> visited;
+    vector<JobHandle> pending { job };
+    while (!pending.empty()) {
+        auto current = pending.back();
+        pending.pop_back();
+        if (current->complete || !visited.insert(current.get()).second) continue;
+        chain->push_back(current);
+        std::unique_lock<std::mutex> jobLock(current->lock);
+        pending.insert(pending.end(), current->dependencies.begin(), current->dependencies.end());
+    }
+}
+
+JobHandle JobSystem::findJobFor(vector<JobHandle> *chain) {
+    chain->erase(std::remove_if(chain->begin(), chain->end(), [](const JobHandle &member) {
+        return member->complete.load();
+    }), chain->end());
+    for (auto &member : *chain) {
+        // Waiting on its dependencies, or already taken by another thread
+        auto index = member->queueIndex.load();
+        if (index < 0) continue;
+        std::unique_lock<std::mutex> queueLock(queues_[index]->lock);
+        if (member->queueIndex != index) continue;
+        auto &jobs = queues_[index]->jobs;
+        // Jobs are pushed to the back, so a job that was just scheduled is found quickly
+        auto it = std::find(jobs.rbegin(), jobs.rend(), member);
+        if (it == jobs.rend()) continue;
+        jobs.erase(std::next(it).base());
+        member->queueIndex = -1;
+        pendingJobs_ -= 1;
+        return member;
+    }
+    return nullptr;
+}
+
+void JobSystem::wait(const JobHandle &job) {
+    if (isComplete(job)) return;
+    vector<JobHandle> chain;
+    collectChain(job, &chain);
+    while (!isComplete(job)) {
+        auto scheduled = scheduledJobs_.load();
+        // Help with our own chain instead of sleeping. Unrelated work could need a lock the caller is holding
+        auto next = findJobFor(&chain);
+        if (next) {
+            execute(next);
+            continue;
+        }
+        // Nothing to help with - sleep until our job finishes or another job becomes runnable
+        std::unique_lock<std::mutex> scopeLock(sleepLock_);
+        jobCompletedSignal_.wait(scopeLock, [this, &job, scheduled]() {
+            return job->complete || scheduledJobs_ != scheduled;
+        });
+    }
+}
+
+JobSystemStats JobSystem::getStats() const {
+    JobSystemStats stats;
+    stats.jobsRun = jobsRun_.load(std::memory_order_relaxed);
+    stats.queueWaitMs = queueWaitNs_.load(std::memory_order_relaxed) / 1e6;
+    stats.workerIdleMs = workerIdleNs_.load(std::memory_order_relaxed) / 1e6;
+    return stats;
+}
+
+uint JobSystem::getDefaultThreadSize() {
+    auto poolSize = std::thread::hardware_concurrency();
+    // Leave a core for the thread driving the game loop - it helps out whenever it waits anyway
+    poolSize = (poolSize > 1) ? poolSize - 1 : 1;
+    printf("JobSystem::getDefaultThreadSize: %u\n", poolSize);
+    return poolSize;
+}
@@ -0,0 +1,253 @@
+/**
+ * @file MeshCollider.cpp
+ * @author Alec Jackson
+ * @brief Static triangle mesh collider stored in a bounding volume hierarchy
+ * @version 0.1
+ * @date 2025
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#include <algorithm>
+#include <cfloat>
+#include <cstdio>
+#include <MeshCollider.hpp>
+
+// Half the surface area of a box - the constant factor does not change which split is cheapest
+static inline float halfArea(const vec3 &minBound, const vec3 &maxBound) {
+    auto extent = glm::max(maxBound - minBound, vec3(0.0f));
+    return extent.x * extent.y + extent.y * extent.z + extent.z * extent.x;
+}
+
+static inline bool boxesOverlap(const vec3 &min1, const vec3 &max1, const vec3 &min2, const vec3 &max2) {
+    return min1.x <= max2.x && max1.x >= min2.x && min1.y <= max2.y && max1.y >= min2.y &&
+        min1.z <= max2.z && max1.z >= min2.z;
+}
+
+MeshCollider::MeshCollider(const vector<float> &vertices) {
+    uint count = static_cast<uint>(vertices.size() / 9);
+    if (count == 0) {
+        fprintf(stderr, "MeshCollider::MeshCollider: No triangles to build a mesh from\n");
+        return;
+    }
+    order_.resize(count);
+    triMin_.resize(count);
+    triMax_.resize(count);
+    centroids_.resize(count);
+    for (uint i = 0; i < count; ++i) {
+        auto v = vertices.data() + i * 9;
+        auto a = vec3(v[0], v[1], v[2]);
+        auto b = vec3(v[3], v[4], v[5]);
+        auto c = vec3(v[6], v[7], v[8]);
+        order_[i] = i;
+        triMin_[i] = glm::min(a, glm::min(b, c));
+        triMax_[i] = glm::max(a, glm::max(b, c));
+        centroids_[i] = (triMin_[i] + triMax_[i]) * 0.5f;
+    }
+    // A binary tree with leaves of at least one triangle never needs more than 2n - 1 nodes
+    nodes_.reserve(count * 2);
+    build(0, count, 0);
+    // Store the triangles in leaf order, so a leaf reads one contiguous run of vertices
+    vertices_.resize(count * 3);
+    for (uint i = 0; i < count; ++i) {
+        auto v = vertices.data() + order_[i] * 9;
+        for (uint corner = 0; corner < 3; ++corner) {
+            vertices_[i * 3 + corner] = vec3(v[corner * 3], v[corner * 3 + 1], v[corner * 3 + 2]);
+        }
+    }
+    nodes_.shrink_to_fit();
+    order_ = vector<uint>();
+    triMin_ = vector<vec3>();
+    triMax_ = vector<vec3>();
+    centroids_ = vector<vec3>();
+    printf("MeshCollider::MeshCollider: Built %u nodes for %u triangles\n", static_cast<uint>(nodes_.size()), count);
+}
+
+std::shared_ptr<MeshCollider> MeshCollider::fromPolygon(const Polygon &polygon) {
+    vector<float> vertices;
+    for (const auto &model : polygon.modelMap) {
+        auto &modelVertices = model.second->vertices;
+        // Drop any partial triangle so it cannot shift the vertices of the next model
+        vertices.insert(vertices.end(), modelVertices.begin(), modelVertices.begin() + (modelVertices.size() / 9) * 9);
+    }
+    return std::make_shared<MeshCollider>(vertices);
+}
+
+void MeshCollider::build(uint begin, uint end, uint depth) {
+    auto nodeIndex = static_cast<uint>(nodes_.size());
+    nodes_.push_back(MeshBvhNode());
+    vec3 minBound(FLT_MAX), maxBound(-FLT_MAX);
+    vec3 centroidMin(FLT_MAX), centroidMax(-FLT_MAX);
+    for (uint i = begin; i < end; ++i) {
+        auto tri = order_[i];
+        minBound = glm::min(minBound, triMin_[tri]);
+        maxBound = glm::max(maxBound, triMax_[tri]);
+        centroidMin = glm::min(centroidMin, centroids_[tri]);
+        centroidMax = glm::max(centroidMax, centroids_[tri]);
+    }
+    nodes_[nodeIndex].minBound = minBound;
+    nodes_[nodeIndex].maxBound = maxBound;
+    uint count = end - begin;
+    auto makeLeaf = [&]() {
+        nodes_[nodeIndex].first = begin;
+        nodes_[nodeIndex].count = count;
+    };
+    if (count <= MESH_BVH_LEAF_SIZE || depth + 1 >= MESH_BVH_MAX_DEPTH) return makeLeaf();
+
+    // Binned surface area heuristic - drop each centroid into a bin along every axis and try a split between each bin
+    struct Bin {
+        vec3 minBound = vec3(FLT_MAX);
+        vec3 maxBound = vec3(-FLT_MAX);
+        uint count = 0;
+    };
+    float bestCost = FLT_MAX;
+    int bestAxis = -1;
+    uint bestSplit = 0;
+    auto centroidExtent = centroidMax - centroidMin;
+    for (int axis = 0; axis < 3; ++axis) {
+        // Every centroid sits on the same plane, so this axis cannot separate anything
+        if (centroidExtent[axis] <= 0.0f) continue;
+        Bin bins[MESH_BVH_BINS];
+        float scale = MESH_BVH_BINS / centroidExtent[axis];
+        for (uint i = begin; i < end; ++i) {
+            auto tri = order_[i];
+            auto bin = std::min(static_cast<uint>((centroids_[tri][axis] - centroidMin[axis]) * scale),
+                static_cast<uint>(MESH_BVH_BINS - 1));
+            bins[bin].minBound = glm::min(bins[bin].minBound, triMin_[tri]);
+            bins[bin].maxBound = glm::max(bins[bin].maxBound, triMax_[tri]);
+            bins[bin].count++;
+        }
+        // Sweep from the right to get the cost of every right hand side, then from the left to finish each split
+        float rightArea[MESH_BVH_BINS];
+        uint rightCount[MESH_BVH_BINS];
+        vec3 sweepMin(FLT_MAX), sweepMax(-FLT_MAX);
+        uint sweepCount = 0;
+        for (int bin = MESH_BVH_BINS - 1; bin > 0; --bin) {
+            sweepMin = glm::min(sweepMin, bins[bin].minBound);
+            sweepMax = glm::max(sweepMax, bins[bin].maxBound);
+            sweepCount += bins[bin].count;
+            rightArea[bin] = halfArea(sweepMin, sweepMax);
+            rightCount[bin] = sweepCount;
+        }
+        sweepMin = vec3(FLT_MAX);
+        sweepMax = vec3(-FLT_MAX);
+        sweepCount = 0;
+        for (uint split = 1; split < MESH_BVH_BINS; ++split) {
+            sweepMin = glm::min(sweepMin, bins[split - 1].minBound);
+            sweepMax = glm::max(sweepMax, bins[split - 1].maxBound);
+            sweepCount += bins[split - 1].count;
+            if (sweepCount == 0 || rightCount[split] == 0) continue;
+            float cost = sweepCount * halfArea(sweepMin, sweepMax) + rightCount[split] * rightArea[split];
+            if (cost < bestCost) {
+                bestCost = cost;
+                bestAxis = axis;
+                bestSplit = split;
+            }
+        }
+    }
+    // Splitting has to beat testing every triangle in this node, unless the leaf would get too big
+    float leafCost = count * halfArea(minBound, maxBound);
+    if (bestAxis < 0 || (bestCost >= leafCost && count <= MESH_BVH_MAX_LEAF_SIZE)) return makeLeaf();
+
+    float scale = MESH_BVH_BINS / centroidExtent[bestAxis];
+    auto splitMin = centroidMin[bestAxis];
+    auto middle = std::partition(order_.begin() + begin, order_.begin() + end, [&](uint tri) {
+        auto bin = std::min(static_cast<uint>((centroids_[tri][bestAxis] - splitMin) * scale),
+            static_cast<uint>(MESH_BVH_BINS - 1));
+        return bin < bestSplit;
+    });
+    auto mid = static_cast<uint>(middle - order_.begin());
+    build(begin, mid, depth + 1);
+    // Assigned after the first subtree is built, since building it grows nodes_
+    nodes_[nodeIndex].first = static_cast<uint>(nodes_.size());
+    nodes_[nodeIndex].count = 0;
+    build(mid, end, depth + 1);
+}
+
+void MeshCollider::query(const vec3 &minBound, const vec3 &maxBound, vector<uint> *triangles) const {
+    triangles->clear();
+    if (nodes_.empty()) return;
+    uint stack[MESH_BVH_MAX_DEPTH];
+    uint stackSize = 0;
+    uint nodeIndex = 0;
+    for (;;) {
+        auto &node = nodes_[nodeIndex];
+        if (boxesOverlap(minBound, maxBound, node.minBound, node.maxBound)) {
+            if (node.count == 0) {
+                stack[stackSize++] = node.first;
+                nodeIndex++;
+                continue;
+            }
+            for (uint tri = node.first; tri < node.first + node.count; ++tri) {
+                auto &a = vertices_[tri * 3];
+                auto &b = vertices_[tri * 3 + 1];
+                auto &c = vertices_[tri * 3 + 2];
+                if (boxesOverlap(minBound, maxBound, glm::min(a, glm::min(b, c)), glm::max(a, glm::max(b, c)))) {
+                    triangles->push_back(tri);
+                }
+            }
+        }
+        if (stackSize == 0) return;
+        nodeIndex = stack[--stackSize];
+    }
+}
+
+// Slab test against a node, returning the entry fraction or a value above limit on a miss
+static inline float rayBox(const vec3 &origin, const vec3 &invMotion, const vec3 &minBound, const vec3 &maxBound,
+    float limit) {
+    float enter = 0.0f;
+    float exit = limit;
+    for (int i = 0; i < 3; ++i) {
+        auto t0 = (minBound[i] - origin[i]) * invMotion[i];
+        auto t1 = (maxBound[i] - origin[i]) * invMotion[i];
+        // A zero motion axis gives inf or nan - nan only shows up when the origin sits on the slab edge
+        if (t0 != t0 || t1 != t1) continue;
+        if (t0 > t1) std::swap(t0, t1);
+        enter = std::max(enter, t0);
+        exit = std::min(exit, t1);
+        if (enter > exit) return FLT_MAX;
+    }
+    return enter;
+}
+
+bool MeshCollider::raycast(const vec3 &origin, const vec3 &motion, float *fraction, uint *triangle) const {
+    if (nodes_.empty()) return false;
+    auto invMotion = vec3(1.0f) / motion;
+    bool hit = false;
+    uint stack[MESH_BVH_MAX_DEPTH];
+    uint stackSize = 0;
+    uint nodeIndex = 0;
+    for (;;) {
+        auto &node = nodes_[nodeIndex];
+        if (rayBox(origin, invMotion, node.minBound, node.maxBound, *fraction) <= *fraction) {
+            if (node.count == 0) {
+                stack[stackSize++] = node.first;
+                nodeIndex++;
+                continue;
+            }
+            for (uint tri = node.first; tri < node.first + node.count; ++tri) {
+                // Moller-Trumbore, accepting hits from either side of the triangle
+                auto &a = vertices_[tri * 3];
+                auto edge1 = vertices_[tri * 3 + 1] - a;
+                auto edge2 = vertices_[tri * 3 + 2] - a;
+                auto p = glm::cross(motion, edge2);
+                auto det = glm::dot(edge1, p);
+                if (det == 0.0f) continue;
+                auto invDet = 1.0f / det;
+                auto s = origin - a;
+                auto u = glm::dot(s, p) * invDet;
+                if (u < 0.0f || u > 1.0f) continue;
+                auto q = glm::cross(s, edge1);
+                auto v = glm::dot(motion, q) * invDet;
+                if (v < 0.0f || u + v > 1.0f) continue;
+                auto t = glm::dot(edge2, q) * invDet;
+                if (t < 0.0f || t > *fraction) continue;
+                *fraction = t;
+                *triangle = tri;
+                hit = true;
+            }
+        }
+        if (stackSize == 0) return hit;
+        nodeIndex = stack[--stackSize];
+    }
+}
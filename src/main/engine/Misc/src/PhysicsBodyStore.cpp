@@ -0,0 +1,139 @@
+/**
+ * @file PhysicsBodyStore.cpp
+ * @author Alec Jackson
+ * @brief Structure of arrays storage for physics body state, addressed through stable integer handles
+ * @version 0.1
+ * @date 2025
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#include <PhysicsBodyStore.hpp>
+#include <cassert>
+#include <cstdio>
+#include <vector>
+
+PhysicsHandle PhysicsBodyStore::add(SceneObject *sceneObject, ColliderExt *sceneCollider) {
+    uint slot;
+    if (!freeSlots_.empty()) {
+        slot = freeSlots_.back();
+        freeSlots_.pop_back();
+    } else {
+        slot = static_cast<uint>(slots_.size());
+        assert(slot <= PHYS_HANDLE_SLOT_MASK);
+        slots_.emplace_back();
+    }
+    slots_[slot].index = size();
+    PhysicsHandle handle = (slots_[slot].generation << PHYS_HANDLE_SLOT_BITS) | slot;
+    handles_.push_back(handle);
+    target.push_back(sceneObject);
+    collider.push_back(sceneCollider);
+    position.push_back(sceneObject->getPosition());
+    prevPos.push_back(sceneObject->getPosition());
+    stepPos.push_back(sceneObject->getPosition());
+    renderPos.push_back(sceneObject->getPosition());
+    positionDelta.push_back(vec3(0));
+    velocity.push_back(vec3(0));
+    velocityDelta.push_back(vec3(0));
+    acceleration.push_back(vec3(0));
+    boundsMin.push_back(vec3(0));
+    boundsMax.push_back(vec3(0));
+    colliderCenter.push_back(vec3(0));
+    colliderOffset.push_back(vec3(0));
+    scale.push_back(vec3(sceneObject->getScale()));
+    runningTime.push_back(0.0);
+    gravTime.push_back(0.0);
+    elasticity.push_back(0.0f);
+    mass.push_back(0.0f);
+    isKinematic.push_back(0);
+    obeyGravity.push_back(0);
+    hasCollision.push_back(0);
+    continuous.push_back(0);
+    mesh.push_back(nullptr);
+    sleepFrames.push_back(0);
+    contactCache.emplace_back();
+    activeSlot_.push_back(static_cast<uint>(active_.size()));
+    active_.push_back(size() - 1);
+    return handle;
+}
+
+void PhysicsBodyStore::wake(uint index) {
+    if (!asleep(index)) return;
+    activeSlot_[index] = static_cast<uint>(active_.size());
+    active_.push_back(index);
+    sleepFrames[index] = 0;
+    sleepVersion_++;
+}
+
+void PhysicsBodyStore::sleep(uint index) {
+    if (asleep(index)) return;
+    removeActive(index);
+    sleepVersion_++;
+}
+
+void PhysicsBodyStore::removeActive(uint index) {
+    auto slot = activeSlot_[index];
+    auto lastActive = active_.back();
+    active_[slot] = lastActive;
+    activeSlot_[lastActive] = slot;
+    active_.pop_back();
+    activeSlot_[index] = PHYS_INVALID_INDEX;
+}
+
+// Moves the last element of an array into the given slot and shrinks the array
+template <typename T>
+static void swapRemove(vector<T> *values, uint index) {
+    (*values)[index] = values->back();
+    values->pop_back();
+}
+
+bool PhysicsBodyStore::remove(PhysicsHandle handle) {
+    auto index = indexOf(handle);
+    if (PHYS_INVALID_INDEX == index) {
+        fprintf(stderr, "PhysicsBodyStore::remove: Handle %u does not refer to a body\n", handle);
+        return false;
+    }
+    if (!asleep(index)) removeActive(index);
+    auto lastHandle = handles_.back();
+    swapRemove(&handles_, index);
+    swapRemove(&target, index);
+    swapRemove(&collider, index);
+    swapRemove(&position, index);
+    swapRemove(&prevPos, index);
+    swapRemove(&stepPos, index);
+    swapRemove(&renderPos, index);
+    swapRemove(&positionDelta, index);
+    swapRemove(&velocity, index);
+    swapRemove(&velocityDelta, index);
+    swapRemove(&acceleration, index);
+    swapRemove(&boundsMin, index);
+    swapRemove(&boundsMax, index);
+    swapRemove(&colliderCenter, index);
+    swapRemove(&colliderOffset, index);
+    swapRemove(&scale, index);
+    swapRemove(&runningTime, index);
+    swapRemove(&gravTime, index);
+    swapRemove(&elasticity, index);
+    swapRemove(&mass, index);
+    swapRemove(&isKinematic, index);
+    swapRemove(&obeyGravity, index);
+    swapRemove(&hasCollision, index);
+    swapRemove(&continuous, index);
+    swapRemove(&mesh, index);
+    swapRemove(&sleepFrames, index);
+    swapRemove(&contactCache, index);
+    swapRemove(&activeSlot_, index);
+    // The last body now lives at index, so its active list entry has to follow it
+    if (index < size() && !asleep(index)) active_[activeSlot_[index]] = index;
+    sleepVersion_++;
+    slots_[PHYS_HANDLE_SLOT(lastHandle)].index = index;
+    auto &slot = slots_[PHYS_HANDLE_SLOT(handle)];
+    slot.index = PHYS_INVALID_INDEX;
+    // Wrap the generation inside the handle bits, and never hand out PHYS_INVALID_HANDLE
+    slot.generation = (slot.generation + 1) & (UINT32_MAX >> PHYS_HANDLE_SLOT_BITS);
+    if (((slot.generation << PHYS_HANDLE_SLOT_BITS) | PHYS_HANDLE_SLOT(handle)) == PHYS_INVALID_HANDLE) {
+        slot.generation = 0;
+    }
+    freeSlots_.push_back(PHYS_HANDLE_SLOT(handle));
+    return true;
+}
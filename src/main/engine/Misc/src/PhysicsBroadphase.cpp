@@ -0,0 +1,139 @@
+/**
+ * @file PhysicsBroadphase.cpp
+ * @author Alec Jackson
+ * @brief Spatial hash broadphase used to cut down the pairs checked in the physics collision stage
+ * @version 0.1
+ * @date 2025
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#include <PhysicsBroadphase.hpp>
+#include <algorithm>
+#include <cfloat>
+#include <cstdio>
+#include <vector>
+
+// 21 bits per axis keeps each packed coordinate unique for +/- ~1 million cells
+#define CELL_BITS 21
+#define CELL_MASK ((1ULL << CELL_BITS) - 1)
+
+SpatialHash::SpatialHash(float cellSize) : cellSize_ { PHYS_BROADPHASE_CELL_SIZE },
+    invCellSize_ { 1.0f / PHYS_BROADPHASE_CELL_SIZE } {
+    setCellSize(cellSize);
+}
+
+void SpatialHash::clear() {
+    cells_.clear();
+    oversized_.clear();
+}
+
+void SpatialHash::setCellSize(float cellSize) {
+    if (cellSize <= 0.0f) {
+        fprintf(stderr, "SpatialHash::setCellSize: Invalid cell size %f, keeping %f\n", cellSize, cellSize_);
+        return;
+    }
+    if (cellSize == cellSize_) return;
+    cellSize_ = cellSize;
+    invCellSize_ = 1.0f / cellSize;
+    clear();
+}
+
+glm::ivec3 SpatialHash::cellCoord(const vec3 &point) const {
+    return glm::ivec3(glm::floor(point * invCellSize_));
+}
+
+uint64_t SpatialHash::hashCell(int x, int y, int z) {
+    return ((static_cast<uint64_t>(x) & CELL_MASK) << (CELL_BITS * 2)) |
+        ((static_cast<uint64_t>(y) & CELL_MASK) << CELL_BITS) |
+        (static_cast<uint64_t>(z) & CELL_MASK);
+}
+
+void SpatialHash::insert(uint index, const vec3 &minBound, const vec3 &maxBound) {
+    auto minCell = cellCoord(minBound);
+    auto maxCell = cellCoord(maxBound);
+    auto span = maxCell - minCell + glm::ivec3(1);
+    // Very large objects (map pieces, floors) would touch too many cells, so every query checks them instead
+    if (static_cast<int64_t>(span.x) * span.y * span.z > PHYS_BROADPHASE_MAX_CELLS) {
+        oversized_.push_back(index);
+        return;
+    }
+    for (int x = minCell.x; x <= maxCell.x; ++x) {
+        for (int y = minCell.y; y <= maxCell.y; ++y) {
+            for (int z = minCell.z; z <= maxCell.z; ++z) {
+                cells_[hashCell(x, y, z)].push_back(index);
+            }
+        }
+    }
+}
+
+void SpatialHash::query(const vec3 &minBound, const vec3 &maxBound, vector<uint> *candidates) const {
+    candidates->clear();
+    candidates->insert(candidates->end(), oversized_.begin(), oversized_.end());
+    auto minCell = cellCoord(minBound - vec3(PHYS_BROADPHASE_MARGIN));
+    auto maxCell = cellCoord(maxBound + vec3(PHYS_BROADPHASE_MARGIN));
+    auto span = maxCell - minCell + glm::ivec3(1);
+    if (static_cast<int64_t>(span.x) * span.y * span.z > static_cast<int64_t>(cells_.size())) {
+        // Query covers more cells than exist, so walking the occupied cells is cheaper
+        for (const auto &cell : cells_) {
+            candidates->insert(candidates->end(), cell.second.begin(), cell.second.end());
+        }
+    } else {
+        for (int x = minCell.x; x <= maxCell.x; ++x) {
+            for (int y = minCell.y; y <= maxCell.y; ++y) {
+                for (int z = minCell.z; z <= maxCell.z; ++z) {
+                    auto cit = cells_.find(hashCell(x, y, z));
+                    if (cit == cells_.end()) continue;
+                    candidates->insert(candidates->end(), cit->second.begin(), cit->second.end());
+                }
+            }
+        }
+    }
+    // Objects spanning several cells show up more than once - sorting also keeps the pair order stable
+    std::sort(candidates->begin(), candidates->end());
+    candidates->erase(std::unique(candidates->begin(), candidates->end()), candidates->end());
+}
+
+void SpatialHash::traverseRay(const vec3 &origin, const vec3 &direction, float maxDistance,
+    const RAY_VISIT_FUNC &visit) const {
+    if (!oversized_.empty() && !visit(oversized_, 0.0f)) return;
+    if (cells_.empty()) return;
+    auto cell = cellCoord(origin);
+    auto endCell = cellCoord(origin + direction * maxDistance);
+    auto crossed = glm::abs(endCell - cell);
+    int64_t steps = static_cast<int64_t>(crossed.x) + crossed.y + crossed.z;
+    if (steps >= static_cast<int64_t>(cells_.size())) {
+        // Long ray through a sparse grid - cheaper to hand over every occupied cell
+        for (const auto &occupied : cells_) {
+            if (!visit(occupied.second, maxDistance)) return;
+        }
+        return;
+    }
+    // Amanatides & Woo grid walk - tMax is the distance to the next cell boundary on each axis
+    glm::ivec3 step;
+    vec3 tMax, tDelta;
+    for (int i = 0; i < 3; ++i) {
+        if (direction[i] > 0.0f) {
+            step[i] = 1;
+            tMax[i] = ((cell[i] + 1) * cellSize_ - origin[i]) / direction[i];
+            tDelta[i] = cellSize_ / direction[i];
+        } else if (direction[i] < 0.0f) {
+            step[i] = -1;
+            tMax[i] = (cell[i] * cellSize_ - origin[i]) / direction[i];
+            tDelta[i] = -cellSize_ / direction[i];
+        } else {
+            step[i] = 0;
+            tMax[i] = FLT_MAX;
+            tDelta[i] = FLT_MAX;
+        }
+    }
+    // The step count bounds the walk, so rounding in tMax can never run it past the end cell
+    for (int64_t i = 0; i <= steps; ++i) {
+        int axis = tMax.x < tMax.y ? (tMax.x < tMax.z ? 0 : 2) : (tMax.y < tMax.z ? 1 : 2);
+        float cellExit = std::min(tMax[axis], maxDistance);
+        auto cit = cells_.find(hashCell(cell.x, cell.y, cell.z));
+        if (cit != cells_.end() && !visit(cit->second, cellExit)) return;
+        cell[axis] += step[axis];
+        tMax[axis] += tDelta[axis];
+    }
+}
@@ -0,0 +1,67 @@
+/**
+ * @file PhysicsCommandQueue.cpp
+ * @author Alec Jackson
+ * @brief Lock-free queue of body changes waiting to be applied by the physics controller
+ * @version 0.1
+ * @date 2025
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#include <PhysicsCommandQueue.hpp>
+
+PhysicsCommandQueue::PhysicsCommandQueue(uint capacity) {
+    size_t size = 2;
+    while (size < capacity) size <<= 1;
+    mask_ = size - 1;
+    cells_ = std::make_unique<Cell[]>(size);
+    // A cell is free for the producer at position p when its sequence equals p
+    for (size_t i = 0; i < size; ++i) {
+        cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+bool PhysicsCommandQueue::push(const PhysicsCommand &command) {
+    auto pos = enqueuePos_.load(std::memory_order_relaxed);
+    for (;;) {
+        auto &cell = cells_[pos & mask_];
+        auto sequence = cell.sequence.load(std::memory_order_acquire);
+        auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+        if (diff == 0) {
+            // The cell is free - claim it, or retry from wherever the producer that beat us left the position
+            if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                cell.command = command;
+                // Publish the command to the consumer
+                cell.sequence.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+        } else if (diff < 0) {
+            // The cell still holds a command from the previous lap, so the queue is full
+            return false;
+        } else {
+            pos = enqueuePos_.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+bool PhysicsCommandQueue::pop(PhysicsCommand *command) {
+    auto pos = dequeuePos_.load(std::memory_order_relaxed);
+    for (;;) {
+        auto &cell = cells_[pos & mask_];
+        auto sequence = cell.sequence.load(std::memory_order_acquire);
+        auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+        if (diff == 0) {
+            if (dequeuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                *command = cell.command;
+                // Hand the cell back to producers for their next lap
+                cell.sequence.store(pos + mask_ + 1, std::memory_order_release);
+                return true;
+            }
+        } else if (diff < 0) {
+            // Nothing has been published to this cell yet, so the queue is empty
+            return false;
+        } else {
+            pos = dequeuePos_.load(std::memory_order_relaxed);
+        }
+    }
+}
@@ -0,0 +1,201 @@
+/**
+ * @file PhysicsQuery.cpp
+ * @author Alec Jackson
+ * @brief Read-only snapshot of the physics bodies used to answer raycast, sweep and overlap queries
+ * @version 0.1
+ * @date 2025
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#include <algorithm>
+#include <cmath>
+#include <PhysicsQuery.hpp>
+
+PhysicsQueryWorld::PhysicsQueryWorld(float cellSize) : hash_ { cellSize } {}
+
+void PhysicsQueryWorld::add(PhysicsHandle handle, SceneObject *object, uint32_t layer, const vec3 &minBound,
+    const vec3 &maxBound, std::shared_ptr<const MeshCollider> mesh, const vec3 &meshPosition, const vec3 &meshScale) {
+    // A flattened mesh cannot be mapped back into model space, so fall back to its box
+    if (meshScale.x == 0.0f || meshScale.y == 0.0f || meshScale.z == 0.0f) mesh = nullptr;
+    hash_.insert(static_cast<uint>(handles_.size()), minBound, maxBound);
+    handles_.push_back(handle);
+    objects_.push_back(object);
+    layers_.push_back(layer);
+    boxes_.push(minBound, maxBound);
+    meshes_.push_back(std::move(mesh));
+    meshPositions_.push_back(meshPosition);
+    meshScales_.push_back(meshScale);
+}
+
+void PhysicsQueryWorld::toMeshSpace(uint index, const vec3 &minBound, const vec3 &maxBound, vec3 *localMin,
+    vec3 *localMax) const {
+    // Negative scales flip the box, so rebuild the corners after mapping
+    auto localA = (minBound - meshPositions_[index]) / meshScales_[index];
+    auto localB = (maxBound - meshPositions_[index]) / meshScales_[index];
+    *localMin = glm::min(localA, localB);
+    *localMax = glm::max(localA, localB);
+}
+
+bool PhysicsQueryWorld::keepCloser(uint index, float fraction, const vec3 &boxMin, const vec3 &boxMax,
+    CastResult *best) const {
+    // Ties go to the lower handle so the result does not depend on the order bodies were visited in
+    if (fraction > 1.0f) return false;
+    if (fraction > best->fraction) return false;
+    if (fraction == best->fraction && handles_[index] >= handles_[best->index]) return false;
+    best->fraction = fraction;
+    best->index = index;
+    best->boxMin = boxMin;
+    best->boxMax = boxMax;
+    best->hasNormal = false;
+    return true;
+}
+
+void PhysicsQueryWorld::castAgainst(uint index, const vec3 &center, const vec3 &halfExtents, const vec3 &motion,
+    uint32_t mask, CastResult *best) const {
+    if (0 == (layers_[index] & mask)) return;
+    if (nullptr != meshes_[index]) return castAgainstMesh(index, center, halfExtents, motion, best);
+    auto boxMin = vec3(boxes_.minX[index], boxes_.minY[index], boxes_.minZ[index]);
+    auto boxMax = vec3(boxes_.maxX[index], boxes_.maxY[index], boxes_.maxZ[index]);
+    // A negative skin grows the box instead of requiring overlap, so flat boxes still have some thickness
+    auto fraction = aabbSweep(center, halfExtents, motion, (boxMin + boxMax) * 0.5f, (boxMax - boxMin) * 0.5f,
+        -PHYS_QUERY_SKIN);
+    keepCloser(index, fraction, boxMin, boxMax, best);
+}
+
+void PhysicsQueryWorld::castAgainstMesh(uint index, const vec3 &center, const vec3 &halfExtents,
+    const vec3 &motion, CastResult *best) const {
+    auto &mesh = meshes_[index];
+    if (halfExtents == vec3(0.0f)) {
+        // Mapping both ends of the ray keeps the fraction along it the same in model space
+        float fraction = std::min(best->fraction, 1.0f);
+        uint triangle = 0;
+        auto localOrigin = (center - meshPositions_[index]) / meshScales_[index];
+        if (!mesh->raycast(localOrigin, motion / meshScales_[index], &fraction, &triangle)) return;
+        auto a = meshCorner(index, triangle, 0);
+        auto b = meshCorner(index, triangle, 1);
+        auto c = meshCorner(index, triangle, 2);
+        if (!keepCloser(index, fraction, glm::min(a, glm::min(b, c)), glm::max(a, glm::max(b, c)), best)) return;
+        // Triangles are hit from either side, so face the normal back along the ray
+        auto normal = glm::normalize(glm::cross(b - a, c - a));
+        best->normal = glm::dot(normal, motion) > 0.0f ? -normal : normal;
+        best->hasNormal = true;
+        return;
+    }
+    vec3 localMin, localMax;
+    toMeshSpace(index, glm::min(center, center + motion) - halfExtents - vec3(PHYS_QUERY_SKIN),
+        glm::max(center, center + motion) + halfExtents + vec3(PHYS_QUERY_SKIN), &localMin, &localMax);
+    thread_local vector<uint> triangles;
+    mesh->query(localMin, localMax, &triangles);
+    for (auto triangle : triangles) {
+        auto a = meshCorner(index, triangle, 0);
+        auto b = meshCorner(index, triangle, 1);
+        auto c = meshCorner(index, triangle, 2);
+        auto triMin = glm::min(a, glm::min(b, c));
+        auto triMax = glm::max(a, glm::max(b, c));
+        auto fraction = aabbSweep(center, halfExtents, motion, (triMin + triMax) * 0.5f, (triMax - triMin) * 0.5f,
+            -PHYS_QUERY_SKIN);
+        keepCloser(index, fraction, triMin, triMax, best);
+    }
+}
+
+void PhysicsQueryWorld::fillCastHit(const CastResult &best, const vec3 &center, const vec3 &halfExtents,
+    const vec3 &motion, PhysicsQueryHit *hit) const {
+    hit->handle = handles_[best.index];
+    hit->object = objects_[best.index];
+    hit->distance = best.fraction * glm::length(motion);
+    hit->point = center + motion * best.fraction;
+    if (best.hasNormal) {
+        hit->normal = best.normal;
+        return;
+    }
+    if (0.0f == best.fraction) {
+        hit->normal = -glm::normalize(motion);
+        return;
+    }
+    // The face that was hit is the one the cast box is pressed furthest against, relative to the combined extents
+    auto delta = hit->point - (best.boxMin + best.boxMax) * 0.5f;
+    auto range = halfExtents + (best.boxMax - best.boxMin) * 0.5f + vec3(PHYS_QUERY_SKIN);
+    int axis = 0;
+    for (int i = 1; i < 3; ++i) {
+        if (std::abs(delta[i]) * range[axis] > std::abs(delta[axis]) * range[i]) axis = i;
+    }
+    hit->normal = vec3(0.0f);
+    hit->normal[axis] = delta[axis] < 0.0f ? -1.0f : 1.0f;
+}
+
+bool PhysicsQueryWorld::raycast(const vec3 &origin, const vec3 &direction, float maxDistance, uint32_t mask,
+    PhysicsQueryHit *hit) const {
+    if (glm::length(direction) == 0.0f || maxDistance <= 0.0f) return false;
+    auto unit = glm::normalize(direction);
+    auto motion = unit * maxDistance;
+    CastResult best;
+    // Cells come nearest first, so once the best hit is before the exit of the cell just walked nothing further can
+    // beat it. Hits right on the exit keep walking, so ties still go to the lower handle.
+    hash_.traverseRay(origin, unit, maxDistance, [&](const vector<uint> &indices, float cellExit) {
+        for (auto index : indices) {
+            castAgainst(index, origin, vec3(0.0f), motion, mask, &best);
+        }
+        return best.fraction > 1.0f || best.fraction * maxDistance >= cellExit;
+    });
+    if (best.fraction > 1.0f) return false;
+    fillCastHit(best, origin, vec3(0.0f), motion, hit);
+    return true;
+}
+
+bool PhysicsQueryWorld::sweepBox(const vec3 &center, const vec3 &halfExtents, const vec3 &direction,
+    float maxDistance, uint32_t mask, PhysicsQueryHit *hit) const {
+    if (glm::length(direction) == 0.0f || maxDistance <= 0.0f) return false;
+    auto extents = glm::abs(halfExtents);
+    auto motion = glm::normalize(direction) * maxDistance;
+    auto end = center + motion;
+    // Swept boxes cover a volume rather than a line, so collect every body in the bounds of the whole sweep
+    thread_local vector<uint> candidates;
+    hash_.query(glm::min(center, end) - extents - vec3(PHYS_QUERY_SKIN),
+        glm::max(center, end) + extents + vec3(PHYS_QUERY_SKIN), &candidates);
+    CastResult best;
+    for (auto index : candidates) {
+        castAgainst(index, center, extents, motion, mask, &best);
+    }
+    if (best.fraction > 1.0f) return false;
+    fillCastHit(best, center, extents, motion, hit);
+    return true;
+}
+
+uint PhysicsQueryWorld::overlapBox(const vec3 &center, const vec3 &halfExtents, uint32_t mask,
+    vector<PhysicsQueryHit> *hits) const {
+    hits->clear();
+    auto extents = glm::abs(halfExtents);
+    auto queryMin = center - extents;
+    auto queryMax = center + extents;
+    thread_local vector<uint> candidates;
+    hash_.query(queryMin, queryMax, &candidates);
+    for (auto index : candidates) {
+        if (0 == (layers_[index] & mask)) continue;
+        auto boxMin = vec3(boxes_.minX[index], boxes_.minY[index], boxes_.minZ[index]);
+        auto boxMax = vec3(boxes_.maxX[index], boxes_.maxY[index], boxes_.maxZ[index]);
+        if (ALL_MATCH != aabbOverlap(queryMin, queryMax, boxMin, boxMax)) continue;
+        if (nullptr != meshes_[index] && !overlapsMesh(index, center, extents)) continue;
+        PhysicsQueryHit overlap;
+        overlap.handle = handles_[index];
+        overlap.object = objects_[index];
+        overlap.point = center;
+        hits->push_back(overlap);
+    }
+    std::sort(hits->begin(), hits->end(), [](const PhysicsQueryHit &a, const PhysicsQueryHit &b) {
+        return a.handle < b.handle;
+    });
+    return static_cast<uint>(hits->size());
+}
+
+bool PhysicsQueryWorld::overlapsMesh(uint index, const vec3 &center, const vec3 &halfExtents) const {
+    vec3 localMin, localMax;
+    toMeshSpace(index, center - halfExtents, center + halfExtents, &localMin, &localMax);
+    thread_local vector<uint> triangles;
+    meshes_[index]->query(localMin, localMax, &triangles);
+    for (auto triangle : triangles) {
+        if (aabbTriangleOverlap(center, halfExtents, meshCorner(index, triangle, 0), meshCorner(index, triangle, 1),
+            meshCorner(index, triangle, 2))) return true;
+    }
+    return false;
+}
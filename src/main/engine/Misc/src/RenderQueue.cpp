@@ -0,0 +1,66 @@
+/**
+ * @file RenderQueue.cpp
+ * @author Alec Jackson
+ * @brief Implementation of the per-frame render queue
+ * @version 0.1
+ * @date 2025
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#include <algorithm>
+#include <RenderQueue.hpp>
+
+// Mask of the low bits of a value
+#define RENDER_KEY_MASK(bits) ((static_cast<uint64_t>(1) << (bits)) - 1)
+
+// Maps depth from 0 (near) to 1 (far) onto the depth field
+static inline uint64_t quantizeDepth(float depth) {
+    return static_cast<uint64_t>(std::clamp(depth, 0.0f, 1.0f) * RENDER_KEY_MASK(RENDER_KEY_DEPTH_BITS));
+}
+
+uint64_t RenderQueue::makeKey(uint priority, uint program, uint texture, uint vao, float depth) {
+    uint64_t key = priority & RENDER_KEY_MASK(RENDER_KEY_PRIORITY_BITS);
+    key <<= RENDER_KEY_BLENDED_BITS;
+    key = (key << RENDER_KEY_PROGRAM_BITS) | (program & RENDER_KEY_MASK(RENDER_KEY_PROGRAM_BITS));
+    key = (key << RENDER_KEY_TEXTURE_BITS) | (texture & RENDER_KEY_MASK(RENDER_KEY_TEXTURE_BITS));
+    key = (key << RENDER_KEY_VAO_BITS) | (vao & RENDER_KEY_MASK(RENDER_KEY_VAO_BITS));
+    key = (key << RENDER_KEY_DEPTH_BITS) | quantizeDepth(depth);
+    return key;
+}
+
+uint64_t RenderQueue::makeBlendedKey(uint priority, float depth, uint64_t sequence) {
+    uint64_t key = priority & RENDER_KEY_MASK(RENDER_KEY_PRIORITY_BITS);
+    key = (key << RENDER_KEY_BLENDED_BITS) | 1;
+    // Far to near, so a nearer object is painted over whatever is behind it
+    key = (key << RENDER_KEY_DEPTH_BITS) | (RENDER_KEY_MASK(RENDER_KEY_DEPTH_BITS) - quantizeDepth(depth));
+    key = (key << RENDER_KEY_SEQUENCE_BITS) | (sequence & RENDER_KEY_MASK(RENDER_KEY_SEQUENCE_BITS));
+    return key;
+}
+
+void RenderQueue::sort() {
+    constexpr uint buckets = 1u << RENDER_SORT_RADIX_BITS;
+    constexpr uint passes = 64 / RENDER_SORT_RADIX_BITS;
+    auto count = packets_.size();
+    if (count < 2) return;
+    scratch_.resize(count);
+    for (uint pass = 0; pass < passes; ++pass) {
+        auto shift = pass * RENDER_SORT_RADIX_BITS;
+        size_t offsets[buckets] = {};
+        for (auto &packet : packets_) {
+            offsets[(packet.key >> shift) & (buckets - 1)]++;
+        }
+        // Every key shares this digit, so the pass would not move anything
+        if (offsets[(packets_[0].key >> shift) & (buckets - 1)] == count) continue;
+        size_t start = 0;
+        for (uint bucket = 0; bucket < buckets; ++bucket) {
+            auto bucketSize = offsets[bucket];
+            offsets[bucket] = start;
+            start += bucketSize;
+        }
+        for (auto &packet : packets_) {
+            scratch_[offsets[(packet.key >> shift) & (buckets - 1)]++] = packet;
+        }
+        packets_.swap(scratch_);
+    }
+}
@@ -0,0 +1,88 @@
+/**
+ * @file SpriteBatch.cpp
+ * @author Alec Jackson
+ * @brief Implementation of the 2D sprite batch
+ * @version 0.1
+ * @date 2025
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#include <algorithm>
+#include <SpriteBatch.hpp>
+
+SpriteBatch::~SpriteBatch() {
+    release();
+}
+
+void SpriteBatch::add(uint texture, const mat4 &model, const float *vertices, uint vertexCount, const vec4 &tint) {
+    if (draws_.empty() || draws_.back().texture != texture) {
+        draws_.push_back(SpriteBatchDraw { texture, this->vertexCount(), 0 });
+    }
+    draws_.back().vertexCount += vertexCount;
+    for (uint i = 0; i < vertexCount; ++i) {
+        auto vertex = vertices + i * SPRITE_BATCH_VERTEX_FLOATS;
+        auto position = model * vec4(vertex[0], vertex[1], 0.0f, 1.0f);
+        vertices_.push_back(position.x);
+        vertices_.push_back(position.y);
+        vertices_.push_back(vertex[2]);
+        vertices_.push_back(vertex[3]);
+        tints_.insert(tints_.end(), glm::value_ptr(tint), glm::value_ptr(tint) + SPRITE_BATCH_TINT_FLOATS);
+    }
+}
+
+void SpriteBatch::draw(GfxController *gfxController) {
+    if (draws_.empty()) return;
+    upload(gfxController);
+    gfxController->bindVao(vao_);
+    for (auto &draw : draws_) {
+        gfxController->bindTexture(draw.texture, GfxTextureType::NORMAL);
+        gfxController->drawTrianglesRange(draw.vertexCount, draw.first);
+    }
+    gfxController->bindVao(0);
+    gfxController->bindTexture(0, GfxTextureType::NORMAL);
+}
+
+void SpriteBatch::upload(GfxController *gfxController) {
+    if (gfxController != gfxController_) {
+        // Buffers belong to the controller that created them
+        release();
+        gfxController_ = gfxController;
+    }
+    auto count = vertexCount();
+    if (vao_ == UINT_MAX) {
+        gfxController->initVao(&vao_);
+        gfxController->bindVao(vao_);
+        gfxController->generateBuffer(&vertexBuffer_);
+        gfxController->bindBuffer(vertexBuffer_);
+        gfxController->enableVertexAttArray(SPRITE_BATCH_VERTEX_ATTR, SPRITE_BATCH_VERTEX_FLOATS, sizeof(float), 0);
+        gfxController->generateBuffer(&tintBuffer_);
+        gfxController->bindBuffer(tintBuffer_);
+        gfxController->enableVertexAttArray(SPRITE_BATCH_TINT_ATTR, SPRITE_BATCH_TINT_FLOATS, sizeof(float), 0);
+        gfxController->bindBuffer(0);
+        gfxController->bindVao(0);
+    }
+    if (count > capacity_) {
+        // Double the storage so a batch growing a few sprites at a time does not reallocate every frame. The VAO
+        // points at the buffers rather than their storage, so the attributes stay attached
+        capacity_ = std::max(count, capacity_ * 2);
+        gfxController->bindBuffer(vertexBuffer_);
+        gfxController->sendBufferDataDynamic(sizeof(float) * SPRITE_BATCH_VERTEX_FLOATS * capacity_, nullptr);
+        gfxController->bindBuffer(tintBuffer_);
+        gfxController->sendBufferDataDynamic(sizeof(float) * SPRITE_BATCH_TINT_FLOATS * capacity_, nullptr);
+        gfxController->bindBuffer(0);
+    }
+    gfxController->updateBufferData(vertices_, vertexBuffer_);
+    gfxController->updateBufferData(tints_, tintBuffer_);
+}
+
+void SpriteBatch::release() {
+    if (vao_ == UINT_MAX) return;
+    gfxController_->deleteBuffer(&vertexBuffer_);
+    gfxController_->deleteBuffer(&tintBuffer_);
+    gfxController_->deleteVao(&vao_);
+    vao_ = UINT_MAX;
+    vertexBuffer_ = UINT_MAX;
+    tintBuffer_ = UINT_MAX;
+    capacity_ = 0;
+}
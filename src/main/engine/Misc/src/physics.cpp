@@ -15,133 +15,347 @@
 #include <shared_mutex>
 #include <string>
 #include <algorithm>
-#include <condition_variable> //NOLINT
+#include <iterator>
 #include <memory>
 #include <cstdio>
-#include <thread> //NOLINT
 #include <ColliderObject.hpp>
+#include <CollisionKernel.hpp>
 
 extern double deltaTime;
 
-#define GRAV_FUNC vec3(0.5f) * vec3(0, -GRAVITY_CONST, 0) * vec3(gravTime * gravTime)
-
-void PhysicsObject::updatePosition() {
-    prevPos = target->getPosition();
-    float cappedTime = CAP_TIME(deltaTime);
-    runningTime += cappedTime;
-    // Acceleration
-    vec3 pos = vec3(0.5f) * acceleration * vec3(runningTime * runningTime);
-    if (obeyGravity) {
-        gravTime += cappedTime;
-        pos += GRAV_FUNC;
-    }
-    // Velocity
-    pos += (velocity * vec3(runningTime));
-    // Position
-    pos += position;
-
-    // Update the position of the target object
-    target->setPosition(pos);
-    target->updateModelMatrices();
-    if (targetCollider) targetCollider->updateCollider();
+#define GRAV_FUNC(gTime) vec3(0.5f) * vec3(0, -GRAVITY_CONST, 0) * vec3((gTime) * (gTime))
+
+void PhysicsController::updatePositions(uint begin, uint end) {
+    float stepTime = stepTime_;
+    auto &b = bodies_;
+    auto &active = b.active();
+    // Pure math over the body arrays - targets are only written when the results are published, so there is no
+    // pointer chasing and the compiler is free to vectorize this loop
+    for (uint k = begin; k < end; ++k) {
+        auto i = active[k];
+        b.runningTime[i] += stepTime;
+        b.gravTime[i] += b.obeyGravity[i] ? stepTime : 0.0f;
+        auto runningTime = b.runningTime[i];
+        // Acceleration
+        vec3 pos = vec3(0.5f) * b.acceleration[i] * vec3(runningTime * runningTime);
+        if (b.obeyGravity[i]) pos += GRAV_FUNC(b.gravTime[i]);
+        // Velocity
+        pos += (b.velocity[i] * vec3(runningTime));
+        // Position
+        pos += b.position[i];
+        b.prevPos[i] = b.stepPos[i];
+        b.stepPos[i] = pos;
 #if (PHYS_TRACE == 1)
-    printf("PhysicsObject::updatePosition[%s]: gravTime %f\n", target->objectName().c_str(), gravTime);
-    printf("PhysicsObject::updatePosition[%s]: gravityInfluence %f\n", target->objectName().c_str(), (GRAV_FUNC).y);
-    printf("PhysicsObject::updatePosition[%s]: Updated position is %f, %f, %f\n", target->objectName().c_str(),
-        pos.x, pos.y, pos.z);
+        printf("PhysicsController::updatePositions[%s]: gravTime %f\n", b.target[i]->objectName().c_str(),
+            b.gravTime[i]);
+        printf("PhysicsController::updatePositions[%s]: gravityInfluence %f\n", b.target[i]->objectName().c_str(),
+            (GRAV_FUNC(b.gravTime[i])).y);
+        printf("PhysicsController::updatePositions[%s]: Updated position is %f, %f, %f\n",
+            b.target[i]->objectName().c_str(), pos.x, pos.y, pos.z);
 #endif
+    }
+}
+
+void PhysicsController::adoptTargetPositions(uint begin, uint end) {
+    for (uint i = begin; i < end; ++i) {
+        // Copied while the caller waits, since the steps run alongside game threads that can rescale the target
+        bodies_.scale[i] = vec3(bodies_.target[i]->getScale());
+        // A sleeping body's box is cached in the sleeping broadphase, so it has to wake to be seen in its new place
+        if (adoptTargetPosition(i) && bodies_.asleep(i)) requestWake(i);
+    }
+}
+
+bool PhysicsController::adoptTargetPosition(uint index) {
+    auto &b = bodies_;
+    auto current = b.target[index]->getPosition();
+    if (current == b.renderPos[index]) return false;
+    // Moved outside of the controller - start from the new position without interpolating towards it
+    b.prevPos[index] = current;
+    b.stepPos[index] = current;
+    b.renderPos[index] = current;
+    return true;
+}
+
+void PhysicsController::publishTargets(uint begin, uint end) {
+    auto &active = bodies_.active();
+    for (uint k = begin; k < end; ++k) {
+        publishTarget(active[k]);
+    }
+}
+
+void PhysicsController::publishTarget(uint index) {
+    auto &b = bodies_;
+    auto target = b.target[index];
+    target->setPosition(interpolated_ ? glm::mix(b.prevPos[index], b.stepPos[index], alpha_) : b.stepPos[index]);
+    // Read back so parented targets compare equal on the next adopt
+    b.renderPos[index] = target->getPosition();
+    target->updateModelMatrices();
+    if (b.collider[index]) b.collider[index]->updateCollider();
+}
+
+vec3 PhysicsController::physicsPosition(uint index) {
+    return bodies_.stepPos[index];
 }
 
-void PhysicsObject::flushPosition() {
+void PhysicsController::flushPosition(uint index) {
     // Flush updated position to reference position - ignore gravity
-    position = target->getPosition() - GRAV_FUNC;
+    bodies_.position[index] = physicsPosition(index) - GRAV_FUNC(bodies_.gravTime[index]);
 }
 
-void PhysicsObject::flushVelocity() {
+void PhysicsController::flushVelocity(uint index) {
     // Update velocity using acceleration
-    velocity = (acceleration * vec3(runningTime)) + velocity;
+    bodies_.velocity[index] = (bodies_.acceleration[index] * vec3(bodies_.runningTime[index])) +
+        bodies_.velocity[index];
+}
+
+void PhysicsController::fullFlush(uint index) {
+    flushPosition(index);
+    flushVelocity(index);
+    bodies_.runningTime[index] = 0.0;
+}
+
+// Packs a pair of handles into one sortable key, lower handle first so both sides of a contact produce the same key
+static inline uint64_t contactKey(PhysicsHandle first, PhysicsHandle second) {
+    return (static_cast<uint64_t>(std::min(first, second)) << 32) | std::max(first, second);
 }
 
-// Does nothing for now, but will be used when jerk implemented...
-// DELETE if we never implement jerk :)
-void PhysicsObject::flushAcceleration() {
+/**
+ * @brief Finds a body's cached contact with another body. Candidates come in the same order every step, so the search
+ * starts where the last one finished and normally finds the entry straight away.
+ * @param cache Contact cache from the last step.
+ * @param other Handle of the other body.
+ * @param cursor Entry to start searching from. Moved past the entry found.
+ * @return The cached contact, or nullptr when the pair was not cached.
+ */
+static PhysicsContactCache *findCachedContact(vector<PhysicsContactCache> *cache, PhysicsHandle other, uint *cursor) {
+    auto size = static_cast<uint>(cache->size());
+    for (uint i = 0; i < size; ++i) {
+        auto k = (*cursor + i) % size;
+        if ((*cache)[k].other != other) continue;
+        *cursor = k + 1;
+        return &(*cache)[k];
+    }
+    return nullptr;
+}
+
+// Unit vector along the largest component of push, keeping its sign
+static inline vec3 pushAxis(const vec3 &push) {
+    auto magnitude = glm::abs(push);
+    int axis = 0;
+    if (magnitude.y > magnitude[axis]) axis = 1;
+    if (magnitude.z > magnitude[axis]) axis = 2;
+    vec3 normal(0.0f);
+    normal[axis] = push[axis] < 0.0f ? -1.0f : 1.0f;
+    return normal;
+}
+
+void PhysicsController::addCandidate(uint other, const vec3 &center, const vec3 &offset, const vec3 &prevCenter,
+    uint triangle, CollisionScratch *scratch) {
+    scratch->others.push_back(other);
+    scratch->centers.push_back(center);
+    scratch->offsets.push_back(offset);
+    scratch->prevCenters.push_back(prevCenter);
+    scratch->triangles.push_back(triangle);
+    scratch->current.push(center - offset, center + offset);
+    scratch->previous.push(prevCenter - offset, prevCenter + offset);
+}
+
+void PhysicsController::gatherMeshTriangles(uint other, const vec3 &minBound, const vec3 &maxBound,
+    CollisionScratch *scratch) {
+    auto &mesh = bodies_.mesh[other];
+    auto position = bodies_.stepPos[other];
+    auto scale = meshScale(other);
+    // A flattened mesh has no triangles anyone could stand on
+    if (scale.x == 0.0f || scale.y == 0.0f || scale.z == 0.0f) return;
+    // Negative scales flip the box, so rebuild the corners after mapping into model space
+    auto localA = (minBound - position) / scale;
+    auto localB = (maxBound - position) / scale;
+    mesh->query(glm::min(localA, localB), glm::max(localA, localB), &scratch->meshTriangles);
+    auto prevShift = bodies_.prevPos[other] - position;
+    for (auto tri : scratch->meshTriangles) {
+        auto first = static_cast<uint>(scratch->corners.size());
+        for (uint corner = 0; corner < 3; ++corner) {
+            scratch->corners.push_back(position + scale * mesh->vertex(tri, corner));
+        }
+        auto &a = scratch->corners[first];
+        auto &b = scratch->corners[first + 1];
+        auto &c = scratch->corners[first + 2];
+        auto triMin = glm::min(a, glm::min(b, c));
+        auto triMax = glm::max(a, glm::max(b, c));
+        auto center = (triMin + triMax) * 0.5f;
+        addCandidate(other, center, (triMax - triMin) * 0.5f, center + prevShift, first, scratch);
+    }
 }
 
-void PhysicsObject::fullFlush() {
-    flushPosition();
-    flushVelocity();
-    flushAcceleration();
-    runningTime = 0.0;
+vec3 PhysicsController::meshScale(uint index) {
+    // Colliders ignore rotation, so the mesh only follows the scale on the diagonal
+    return bodies_.scale[index];
 }
 
-void PhysicsObject::updateCollision(const map<string, std::shared_ptr<PhysicsObject>> &objects) {
+void PhysicsController::updateCollision(uint index, const vector<uint> &candidates, CollisionScratch *scratch) {
+    auto &b = bodies_;
+    // The cache is rebuilt from this step's candidates, so pairs the broadphase stopped returning are dropped
+    auto &cache = b.contactCache[index];
+    auto &previousCache = scratch->previousCache;
+    previousCache.clear();
+    previousCache.swap(cache);
+    auto targetCollider = b.collider[index];
     if (nullptr == targetCollider) return;
-    if (!isKinematic) return;
-    // Iterate through all other objects - VERY EXPENSIVE!!!
-    for (const auto &obj : objects) {
-        if (nullptr == obj.second.get()->targetCollider) continue;
-        if (nullptr == obj.second->targetCollider->getCollider()) continue;
-        if (obj.first.compare(target->objectName()) == 0) continue;
+    if (!b.isKinematic[index]) return;
+    auto targetBox = targetCollider->getCollider();
+    if (nullptr == targetBox) return;
+    // Collides with nothing
+    if (0 == targetBox->mask()) return;
+    auto targetOffset = b.colliderOffset[index];
+    auto prevCenter = b.prevPos[index] + b.colliderCenter[index];
+    auto shiftedCenter = b.stepPos[index] + b.positionDelta[index] + b.colliderCenter[index];
+    // Gather the boxes of the candidates handed to us by the broadphase so they can be tested as a batch
+    auto &others = scratch->others;
+    auto &centers = scratch->centers;
+    auto &offsets = scratch->offsets;
+    auto &prevCenters = scratch->prevCenters;
+    auto &triangles = scratch->triangles;
+    auto &corners = scratch->corners;
+    others.clear();
+    centers.clear();
+    offsets.clear();
+    prevCenters.clear();
+    triangles.clear();
+    corners.clear();
+    scratch->current.clear();
+    scratch->previous.clear();
+    for (auto other : candidates) {
+        auto otherCollider = b.collider[other];
+        if (nullptr == otherCollider) continue;
+        if (nullptr == otherCollider->getCollider()) continue;
+        if (other == index) continue;
+        // Layer filtering is a pair of ANDs, so reject filtered pairs before touching any geometry
+        if (!targetBox->canCollide(otherCollider->getCollider())) continue;
+        if (nullptr != b.mesh[other]) {
+            // Only the triangles near the path of this body take part, each standing in for the body
+            auto margin = targetOffset + vec3(PHYS_BROADPHASE_MARGIN);
+            gatherMeshTriangles(other, glm::min(prevCenter, shiftedCenter) - margin,
+                glm::max(prevCenter, shiftedCenter) + margin, scratch);
+            continue;
+        }
+        addCandidate(other, b.stepPos[other] + b.colliderCenter[other], b.colliderOffset[other],
+            b.prevPos[other] + b.colliderCenter[other], PHYS_INVALID_INDEX, scratch);
+    }
+    uint count = static_cast<uint>(others.size());
+    if (0 == count) return;
+    scratch->pairsTested += count;
+    auto &currentMasks = scratch->currentMasks;
+    auto &previousMasks = scratch->previousMasks;
+    currentMasks.resize(count);
+    previousMasks.resize(count);
+    aabbOverlapBatch(prevCenter - targetOffset, prevCenter + targetOffset, scratch->previous, 0, count,
+        previousMasks.data());
+    aabbOverlapBatch(shiftedCenter - targetOffset, shiftedCenter + targetOffset, scratch->current, 0, count,
+        currentMasks.data());
+    if (b.continuous[index]) {
+        // Find the first candidate the box sweeps into on its way from the previous position. Other bodies are
+        // treated as sitting at their end of step positions.
+        auto motion = shiftedCenter - prevCenter;
+        float firstHit = PHYS_SWEEP_MISS;
+        for (uint k = 0; k < count; ++k) {
+            // Already touching before this step - the discrete checks below handle these
+            if (previousMasks[k] == ALL_MATCH) continue;
+            firstHit = std::min(firstHit, aabbSweep(prevCenter, targetOffset, motion, centers[k], offsets[k],
+                PHYS_CCD_SKIN));
+        }
+        if (firstHit < 1.0f) {
+            // Pull the body back to just inside the first contact, so it gets the same response as a slow body
+            b.positionDelta[index] += motion * (firstHit - 1.0f);
+            // Finalize has to apply the pull back even if rounding leaves the body just short of the contact
+            b.hasCollision[index] = true;
+            shiftedCenter = b.stepPos[index] + b.positionDelta[index] + b.colliderCenter[index];
+            aabbOverlapBatch(shiftedCenter - targetOffset, shiftedCenter + targetOffset, scratch->current, 0, count,
+                currentMasks.data());
+        }
+    }
+    uint cacheCursor = 0;
+    for (uint k = 0; k < count; ++k) {
+        auto other = others[k];
         /**
          * If both objects are kinematic, have the objects bounce off of each other.
          * If one object is kinematic, then the kinematic object will clip to touch the non-kinematic object.
          * If no objects are kinematic, then they phase through each other.
          */
         // What do we do when we see a collision?
-        auto shiftedPos = target->getPosition() + positionDelta;
-        int collState = ColliderExt::getCollisionRaw(shiftedPos, targetCollider,
-            obj.second->target->getPosition(), obj.second->targetCollider);
-        if (collState != ALL_MATCH) continue;
-        // Figure out the change in axis (which axis we are now colliding on)
-        int prevCollState = ColliderExt::getCollisionRaw(prevPos,
-            targetCollider, obj.second->prevPos, obj.second->targetCollider);
-        int deltaAxis = collState ^ prevCollState;
-        bool updateGState = false;
-        // Test the collision with the two object's previous positions to get the collstate delta.
-        // If the objects match, then we need to know what the deltaAxis were...
-        // Don't update non-kinematic objects
-        if (isKinematic) {
-            // All of the speed will be in acceleration, so we need to account for that...
-            auto v1 = velocity + (acceleration * vec3(runningTime));
-            auto v2 = obj.second->velocity + (obj.second->acceleration * vec3(obj.second->runningTime));
-            auto m1 = mass;
-            auto m2 = obj.second->mass;
-
-            // Calculate the final velocity of the main object
-            // Only change velocity if the other object is kinematic
-            auto vd = vec3(0);
-            if (obj.second->isKinematic) {
-                // Fetch a velocity delta from the final velocity
-                auto v1f = ((m1 - m2) / (m1 + m2) * v1) + ((2 * m2) / (m1 + m2) * v2);
-                vd = (v1f - v1);
+        int collState = currentMasks[k];
+        auto triangle = triangles[k];
+        // A mesh body stands in for many triangles at once, so only box pairs are cached
+        PhysicsContactCache *cached = nullptr;
+        if (PHYS_INVALID_INDEX == triangle) cached = findCachedContact(&previousCache, b.handleOf(other), &cacheCursor);
+        // A triangle's bounds cover far more space than the triangle itself, so confirm the hit against the triangle
+        if (collState != ALL_MATCH || (PHYS_INVALID_INDEX != triangle && !aabbTriangleOverlap(shiftedCenter,
+            targetOffset, corners[triangle], corners[triangle + 1], corners[triangle + 2]))) {
+            // Still a candidate, so keep the pair cached in case it touches again
+            if (nullptr != cached) {
+                cache.push_back(*cached);
+                cache.back().otherIndex = other;
+                cache.back().penetration = 0.0f;
+                cache.back().accumulated = 0.0f;
+                cache.back().touching = 0;
             }
+            continue;
+        }
+        auto shiftedPos = b.stepPos[index] + b.positionDelta[index];
+        // Wake kinematic bodies we run into so they react this step. Non-kinematic bodies never move on contact.
+        if (b.isKinematic[other] && b.asleep(other)) requestWake(other);
+        if (recordContacts_) scratch->contacts.push_back(contactKey(b.handleOf(index), b.handleOf(other)));
+        scratch->contactsFound++;
+        bool updateGState = false;
+        // All of the speed will be in acceleration, so we need to account for that...
+        auto v1 = b.velocity[index] + (b.acceleration[index] * vec3(b.runningTime[index]));
+        auto v2 = b.velocity[other] + (b.acceleration[other] * vec3(b.runningTime[other]));
+        auto m1 = b.mass[index];
+        auto m2 = b.mass[other];
+
+        // Calculate the final velocity of the main object
+        // Only change velocity if the other object is kinematic
+        auto vd = vec3(0);
+        if (b.isKinematic[other]) {
+            // Fetch a velocity delta from the final velocity
+            auto v1f = ((m1 - m2) / (m1 + m2) * v1) + ((2 * m2) / (m1 + m2) * v2);
+            vd = (v1f - v1);
+        }
 #if (PHYS_TRACE == 1)
-            printf("Collision %s vs %s\n", target->objectName().c_str(), obj.second->target->objectName().c_str());
-            printf("v1i: %f, %f, %f\n", v1.x, v1.y, v1.z);
-            printf("vd: %f, %f, %f\n", vd.x, vd.y, vd.z);
-            printf("pos: %f, %f, %f\n", target->getPosition().x, target->getPosition().y, target->getPosition().z);
-            printf("otherPos: %f, %f, %f\n", obj.second->target->getPosition().x, obj.second->target->getPosition().y,
-                obj.second->target->getPosition().z);
-            printf("prevPos: %f, %f, %f\n", prevPos.x, prevPos.y, prevPos.z);
-            printf("tempPos: %f, %f, %f\n", shiftedPos.x, shiftedPos.y, shiftedPos.z);
-            auto targetcenter = targetCollider->getCenter();
-            auto othercenter = obj.second->targetCollider->getCenter();
-            printf("targetCenter: %f, %f, %f\n", targetcenter.x, targetcenter.y, targetcenter.z);
-            printf("otherCenter: %f, %f, %f\n", othercenter.x, othercenter.y, othercenter.z);
+        auto otherTarget = b.target[other];
+        printf("Collision %s vs %s\n", b.target[index]->objectName().c_str(), otherTarget->objectName().c_str());
+        printf("v1i: %f, %f, %f\n", v1.x, v1.y, v1.z);
+        printf("vd: %f, %f, %f\n", vd.x, vd.y, vd.z);
+        printf("pos: %f, %f, %f\n", b.stepPos[index].x, b.stepPos[index].y, b.stepPos[index].z);
+        printf("otherPos: %f, %f, %f\n", b.stepPos[other].x, b.stepPos[other].y, b.stepPos[other].z);
+        printf("prevPos: %f, %f, %f\n", b.prevPos[index].x, b.prevPos[index].y, b.prevPos[index].z);
+        printf("tempPos: %f, %f, %f\n", shiftedPos.x, shiftedPos.y, shiftedPos.z);
+        auto targetcenter = targetCollider->getCenter();
+        auto othercenter = b.collider[other]->getCenter();
+        printf("targetCenter: %f, %f, %f\n", targetcenter.x, targetcenter.y, targetcenter.z);
+        printf("otherCenter: %f, %f, %f\n", othercenter.x, othercenter.y, othercenter.z);
 #endif
-            // Find the delta velocity for either object - lock each object individually
-            // Probably replace these with macros (TODO)
-            // Do we even need to lock this object?
-            // Convert prev pos to prev center pos using deltas
-            auto targetCenterDelta = targetCollider->getCenter() - target->getPosition();
-            auto otherCenterDelta = obj.second->targetCollider->getCenter() - obj.second->target->getPosition();
+        vec3 edgePoint;
+        if (nullptr != cached && cached->touching) {
+            // Touching last step as well - keep pushing out along the cached axis instead of working it out again.
+            // Measured from where the body started this stage, like the fallback below, so a body squeezed from
+            // both sides is pushed back out evenly.
+            auto startCenter = b.stepPos[index] + b.colliderCenter[index];
+            auto overlap = glm::abs(targetOffset) + glm::abs(offsets[k]) - glm::abs(startCenter - centers[k]);
+            edgePoint = cached->normal * std::max(glm::dot(overlap, glm::abs(cached->normal)), 0.0f);
+            updateGState = 0.0f != cached->normal.y;
+        } else {
+            // Figure out the change in axis (which axis we are now colliding on)
+            // Test the collision with the two object's previous positions to get the collstate delta.
+            // If the objects match, then we need to know what the deltaAxis were...
+            int prevCollState = previousMasks[k];
+            int deltaAxis = collState ^ prevCollState;
             // epSign tells us which direction we are relative to the object we collided with
-            vec3 epSign = sign((prevPos + targetCenterDelta) - (obj.second->prevPos + otherCenterDelta));
+            vec3 epSign = sign(prevCenter - prevCenters[k]);
 #if (PHYS_TRACE == 1)
             printf("epSign: %f, %f, %f\n", epSign.x, epSign.y, epSign.z);
 #endif
-            auto edgePoint = targetCollider->getCollider()->getEdgePointRaw(shiftedPos, targetCollider->getCollider(),
-                obj.second->target->getPosition(), obj.second->targetCollider->getCollider(), epSign);
+            edgePoint = aabbEdgePoint(shiftedPos + b.colliderCenter[index], targetOffset, centers[k], offsets[k],
+                epSign);
             // Sign edge point values based on previous position
             edgePoint *= epSign;
             if (deltaAxis == Y_MATCH) {
@@ -150,8 +364,8 @@ void PhysicsObject::updateCollision(const map<string, std::shared_ptr<PhysicsObj
             }
             // This is messy, so change it later
             if (deltaAxis == NO_MATCH) {
-                edgePoint = targetCollider->getCollider()->getEdgePointPosInf(
-                    obj.second->targetCollider->getCollider());
+                edgePoint = aabbEdgePointPosInf(b.stepPos[index] + b.colliderCenter[index], targetOffset, centers[k],
+                    offsets[k]);
             } else {
                 // Make edge point zero except for delta axis directions.
                 // This is a basic approach - revisit later
@@ -162,118 +376,347 @@ void PhysicsObject::updateCollision(const map<string, std::shared_ptr<PhysicsObj
                     }
                 }
             }
-            if (!obj.second->isKinematic) {
-                // We could modify velocity here, but I honestly don't care about collision spam rn
-            } else {
-                edgePoint /= 2.0f;
-            }
+        }
+        if (!b.isKinematic[other]) {
+            // We could modify velocity here, but I honestly don't care about collision spam rn
+        } else {
+            edgePoint /= 2.0f;
+        }
 #if (PHYS_TRACE == 1)
-            printf("Edge point: %f, %f, %f\n", edgePoint.x, edgePoint.y, edgePoint.z);
+        printf("Edge point: %f, %f, %f\n", edgePoint.x, edgePoint.y, edgePoint.z);
 #endif
-            // UPDATE VALUES
-            {
-                std::unique_lock<std::mutex> scopeLock(objLock);
-                velocityDelta += vd;
-                positionDelta += edgePoint;
-                hasCollision = true;
-                if (updateGState) {
-                    gravTime = 0.0f;
-                    flushPosition();
-                }
+        // UPDATE VALUES - only this body's state is written, so no lock is needed
+        b.velocityDelta[index] += vd;
+        b.positionDelta[index] += edgePoint;
+        b.hasCollision[index] = true;
+        if (updateGState) {
+            b.gravTime[index] = 0.0f;
+            flushPosition(index);
+        }
+        if (PHYS_INVALID_INDEX == triangle) {
+            cache.push_back(nullptr != cached ? *cached :
+                PhysicsContactCache { b.handleOf(other), other, vec3(0.0f), 0.0f, 0.0f, 0 });
+            auto &entry = cache.back();
+            entry.otherIndex = other;
+            entry.touching = 1;
+            if (edgePoint != vec3(0.0f)) entry.normal = pushAxis(edgePoint);
+        }
+        // This body was pushed, so re-test the remaining candidates from its new position
+        shiftedCenter = b.stepPos[index] + b.positionDelta[index] + b.colliderCenter[index];
+        aabbOverlapBatch(shiftedCenter - targetOffset, shiftedCenter + targetOffset, scratch->current, k + 1, count,
+            currentMasks.data() + k + 1);
+    }
+    if (0 == solverIterations_) return;
+    for (auto &entry : cache) {
+        if (!entry.touching) continue;
+        scratch->solverBodies.push_back(index);
+        break;
+    }
+}
+
+void PhysicsController::collideBody(uint index, CollisionScratch *scratch) {
+    if (broadphaseMode_ == PhysicsBroadphase::BRUTE_FORCE) {
+        updateCollision(index, allCollisionBodies_, scratch);
+    } else {
+        collectCandidates(index, scratch);
+        updateCollision(index, scratch->candidates, scratch);
+    }
+}
+
+void PhysicsController::mergeContacts(vector<uint64_t> *contacts) {
+    std::unique_lock<std::mutex> scopeLock(contactLock_);
+    stepContacts_.insert(stepContacts_.end(), contacts->begin(), contacts->end());
+    contacts->clear();
+}
+
+void PhysicsController::submitContacts() {
+    stepCount_++;
+    if (!recordContacts_) {
+        // Nobody is listening - a later subscriber sees every existing contact begin
+        previousContacts_.clear();
+        stepContacts_.clear();
+        return;
+    }
+    // Pairs of kinematic bodies are found from both sides, so drop the duplicates
+    std::sort(stepContacts_.begin(), stepContacts_.end());
+    stepContacts_.erase(std::unique(stepContacts_.begin(), stepContacts_.end()), stepContacts_.end());
+    PhysicsReport report;
+    report.step = stepCount_;
+    {
+        std::shared_lock<std::shared_mutex> scopeLock(physicsObjectQueueLock_);
+        auto addContact = [this, &report](PhysicsContactType type, uint64_t key) {
+            auto body = static_cast<PhysicsHandle>(key >> 32);
+            auto other = static_cast<PhysicsHandle>(key & UINT32_MAX);
+            auto bodyIndex = bodies_.indexOf(body);
+            auto otherIndex = bodies_.indexOf(other);
+            report.contacts.push_back({ type, body, other,
+                bodyIndex != PHYS_INVALID_INDEX ? bodies_.target[bodyIndex] : nullptr,
+                otherIndex != PHYS_INVALID_INDEX ? bodies_.target[otherIndex] : nullptr });
+        };
+        // Both lists are sorted, so a single pass finds the pairs that began, persisted and ended
+        auto &current = stepContacts_;
+        auto &previous = previousContacts_;
+        size_t i = 0, j = 0;
+        while (i < current.size() || j < previous.size()) {
+            if (j == previous.size() || (i < current.size() && current[i] < previous[j])) {
+                addContact(PhysicsContactType::BEGIN, current[i++]);
+            } else if (i == current.size() || previous[j] < current[i]) {
+                addContact(PhysicsContactType::END, previous[j++]);
+            } else {
+                addContact(PhysicsContactType::PERSIST, current[i++]);
+                j++;
+            }
+        }
+    }
+    previousContacts_.swap(stepContacts_);
+    stepContacts_.clear();
+    if (report.contacts.empty()) return;
+    // Held until sync, so callbacks never run in the middle of a step
+    pendingReports_.push_back(std::move(report));
+}
+
+void PhysicsController::requestWake(uint index) {
+    std::unique_lock<std::mutex> scopeLock(wakeLock_);
+    // Several bodies can touch the same sleeper - contacts with sleepers are rare, so a linear check is fine
+    if (std::find(wakeRequests_.begin(), wakeRequests_.end(), index) == wakeRequests_.end()) {
+        wakeRequests_.push_back(index);
+    }
+}
+
+void PhysicsController::wakeTouchedBodies() {
+    while (!wakeRequests_.empty()) {
+        {
+            std::unique_lock<std::shared_mutex> scopeLock(physicsObjectQueueLock_);
+            wokenBodies_.clear();
+            wokenBodies_.swap(wakeRequests_);
+            // Requests arrive in whatever order the batches ran, so sort them to keep the active list the same
+            std::sort(wokenBodies_.begin(), wokenBodies_.end());
+            for (auto index : wokenBodies_) {
+                bodies_.wake(index);
             }
+            // Sleeping bodies have not moved, so their collision state is the same as if they had been awake
+            scheduleBatches(PhysicsWorkType::WAKE);
         }
+        waitPipelineComplete();
     }
 }
 
-void PhysicsObject::updateFinalize() {
+void PhysicsController::updateFinalize(uint index) {
+    auto &b = bodies_;
 #if (PHYS_TRACE == 1)
-    printf("PhysicsObject::finalizeCollisions: for %s\n", target->objectName().c_str());
-    printf("PhysicsObject::finalizeCollisions: Has collision %d\n", hasCollision);
+    auto target = b.target[index];
+    printf("PhysicsController::updateFinalize: for %s\n", target->objectName().c_str());
+    printf("PhysicsController::updateFinalize: Has collision %d\n", b.hasCollision[index]);
 #endif
-    if (!hasCollision) return;
-    auto truePos = target->getPosition();
-    auto newPos = truePos + positionDelta;
-    target->setPosition(newPos);
-    flushPosition();
-    runningTime = 0.0f;
+    bool resting = !b.hasCollision[index] && !b.obeyGravity[index] && b.velocity[index] == vec3(0.0f) &&
+        b.acceleration[index] == vec3(0.0f);
+    b.sleepFrames[index] = resting ? b.sleepFrames[index] + 1 : 0;
+    if (!b.hasCollision[index]) return;
+    auto truePos = b.stepPos[index];
+    auto newPos = truePos + b.positionDelta[index];
+    b.stepPos[index] = newPos;
+    flushPosition(index);
+    b.runningTime[index] = 0.0f;
     // Need to flush acceleration/velocity
-    velocity += velocityDelta;
+    b.velocity[index] += b.velocityDelta[index];
 #if (PHYS_TRACE == 1)
-    printf("PhysicsObject::finalizeCollisions: Updated velocity for %s (%f, %f, %f)\n", target->objectName().c_str(),
-        velocity.x, velocity.y, velocity.z);
-    printf("PhysicsObject::finalizeCollisions: Updated pos for %s (%f, %f, %f)\n", target->objectName().c_str(),
+    printf("PhysicsController::updateFinalize: Updated velocity for %s (%f, %f, %f)\n", target->objectName().c_str(),
+        b.velocity[index].x, b.velocity[index].y, b.velocity[index].z);
+    printf("PhysicsController::updateFinalize: Updated pos for %s (%f, %f, %f)\n", target->objectName().c_str(),
         newPos.x, newPos.y, newPos.z);
-    printf("PhysicsObject::finalizeCollisions: Old pos for %s (%f, %f, %f)\n", target->objectName().c_str(),
+    printf("PhysicsController::updateFinalize: Old pos for %s (%f, %f, %f)\n", target->objectName().c_str(),
         truePos.x, truePos.y, truePos.z);
 #endif
-    acceleration = vec3(0.0f);
-    velocityDelta = vec3(0.0f);
-    positionDelta = vec3(0.0f);
-    hasCollision = false;
-    target->updateModelMatrices();
-    if (targetCollider) targetCollider->updateCollider();
+    b.acceleration[index] = vec3(0.0f);
+    b.velocityDelta[index] = vec3(0.0f);
+    b.positionDelta[index] = vec3(0.0f);
+    b.hasCollision[index] = false;
 }
 
-// Sleep the thread on the work queue until work becomes available
-PhysicsResult PhysicsController::doWork() {
-    while (1) {
-#if (PHYS_TRACE == 1)
-        printf("physDoWork: Waiting for work\n");
-#endif
-        // Fetch work from the work queue if present
-        std::unique_lock <std::mutex> scopeLock(workQueueLock_);
-        workAvailableSignal_.wait(scopeLock, [this] () { return !workQueue_.empty(); });
-        assert(!workQueue_.empty());
-        auto physObj = workQueue_.front();
-        workQueue_.pop();
-        freeWorkers_ -= 1;
-        scopeLock.unlock();  // No longer need lock after pulling work from queue
-        if (physObj->workType == PhysicsWorkType::DIE) {
-            // Close the thread
-            printf("PhysicsController::doWork: Closing on DIE message\n");
-            break;
+void PhysicsController::mergeSolverBodies(vector<uint> *solverBodies) {
+    std::unique_lock<std::mutex> scopeLock(solverLock_);
+    solverBodies_.insert(solverBodies_.end(), solverBodies->begin(), solverBodies->end());
+    solverBodies->clear();
+}
+
+void PhysicsController::solveContacts() {
+    {
+        std::unique_lock<std::shared_mutex> scopeLock(physicsObjectQueueLock_);
+        // Keeps the batches the same from run to run, whatever order the COLLISION batches finished in
+        std::sort(solverBodies_.begin(), solverBodies_.end());
+    }
+    for (solverPass_ = 0; solverPass_ < solverIterations_ && !solverBodies_.empty(); ++solverPass_) {
+        solverMoved_ = false;
+        {
+            std::unique_lock<std::shared_mutex> scopeLock(physicsObjectQueueLock_);
+            scheduleBatches(PhysicsWorkType::SOLVE);
         }
-        string name = physObj->target->objectName();
-        // Position function defined here...
-        /**         1    2
-         *  D(t) =  _ a t  + v t + x
-         *          2
-         */
+        waitPipelineComplete();
+        if (!solverMoved_) break;
+        solverPasses_++;
+        {
+            std::unique_lock<std::shared_mutex> scopeLock(physicsObjectQueueLock_);
+            scheduleBatches(PhysicsWorkType::CORRECT);
+        }
+        waitPipelineComplete();
 #if (PHYS_TRACE == 1)
-        printf("physDoWork: Retrieved gameObject for work [%s], work type [%d]\n", name.c_str(), physObj->workType);
+        printf("PhysicsController::solveContacts: Pass %u moved bodies\n", solverPass_);
 #endif
-        switch (physObj->workType) {
-            case PhysicsWorkType::POSITION:
-                physObj->updatePosition();
-                break;
-            case PhysicsWorkType::COLLISION: {
-                std::shared_lock<std::shared_mutex> objLock(physicsObjectQueueLock_);
-                physObj->updateCollision(physicsObjects_);
-                break;
-            }
-            case PhysicsWorkType::FINALIZE: {
-                physObj->updateFinalize();  // Can use an assert to check for collisions post-update
-                break;
+    }
+    solverBodies_.clear();
+}
+
+bool PhysicsController::solveBody(uint entry, bool warm) {
+    auto &b = bodies_;
+    auto index = solverBodies_[entry];
+    auto center = b.stepPos[index] + b.colliderCenter[index];
+    auto offset = glm::abs(b.colliderOffset[index]);
+    // Pushes on the same axis and side overlap rather than add up, so only the deepest one in each direction counts
+    vec3 pushUp(0.0f), pushDown(0.0f);
+    for (auto &contact : b.contactCache[index]) {
+        if (!contact.touching) continue;
+        auto other = contact.otherIndex;
+        auto delta = center - (b.stepPos[other] + b.colliderCenter[other]);
+        auto overlap = offset + glm::abs(b.colliderOffset[other]) - glm::abs(delta);
+        // Same tolerance as the COLLISION stage, so bodies it left touching are not disturbed
+        if (overlap.x <= PHYS_COLLISION_EPSILON || overlap.y <= PHYS_COLLISION_EPSILON ||
+            overlap.z <= PHYS_COLLISION_EPSILON) {
+            if (warm) {
+                contact.penetration = 0.0f;
+                contact.accumulated = 0.0f;
             }
-            default:
-                printf("HORRIBLE BADNESS\n");
-                break;
+            continue;
+        }
+        // Leave along the axis that takes the smallest move
+        int axis = 0;
+        if (overlap.y < overlap[axis]) axis = 1;
+        if (overlap.z < overlap[axis]) axis = 2;
+        float direction = delta[axis] > 0.0f ? 1.0f : -1.0f;
+        // Perfectly centered pairs split by index so the two bodies move apart instead of together
+        if (delta[axis] == 0.0f) direction = index < other ? -1.0f : 1.0f;
+        // Kinematic pairs record the contact from both sides, so each body covers half of the overlap
+        float share = b.isKinematic[other] ? 0.5f : 1.0f;
+        if (warm) {
+            // How much of the overlap this body ended up covering last step is a far better first guess than an even
+            // split - a body pinned between two others covered none of it
+            if (contact.penetration > 0.0f) share = glm::clamp(contact.accumulated / contact.penetration, 0.0f, 1.0f);
+            contact.normal = vec3(0.0f);
+            contact.normal[axis] = direction;
+            contact.penetration = overlap[axis];
+            contact.accumulated = 0.0f;
         }
+        auto push = overlap[axis] * direction * share;
+        pushUp[axis] = std::max(pushUp[axis], push);
+        pushDown[axis] = std::min(pushDown[axis], push);
+    }
+    b.positionDelta[index] = pushUp + pushDown;
+    return b.positionDelta[index] != vec3(0.0f);
+}
+
+void PhysicsController::applyCorrection(uint index) {
+    auto &b = bodies_;
+    auto correction = b.positionDelta[index];
+    if (correction == vec3(0.0f)) return;
+    b.positionDelta[index] = vec3(0.0f);
+    b.stepPos[index] += correction;
+    // Held up from below, so stop falling the same way landing does in the COLLISION stage
+    if (correction.y > 0.0f && b.obeyGravity[index]) b.gravTime[index] = 0.0;
+    fullFlush(index);
+    // Drop any velocity that would carry the body straight back in
+    for (int i = 0; i < 3; ++i) {
+        if (correction[i] * b.velocity[index][i] < 0.0f) b.velocity[index][i] = 0.0f;
+    }
+    // Remembered so the next step's first pass can start from the share of each contact this body covered
+    for (auto &contact : b.contactCache[index]) {
+        if (contact.touching) contact.accumulated += glm::dot(correction, contact.normal);
+    }
+    b.sleepFrames[index] = 0;
 #if (PHYS_TRACE == 1)
-        printf("physDoWork: Finished work [%s], work type [%d]\n", name.c_str(), physObj->workType);
+    printf("PhysicsController::applyCorrection: Moved %s by %f, %f, %f\n", b.target[index]->objectName().c_str(),
+        correction.x, correction.y, correction.z);
 #endif
-        freeWorkers_ += 1;
-        assert(freeWorkers_ <= threadNum_);
-        if (freeWorkers_ == threadNum_) {
-            // The conditional variables are NOT thread safe and need to be protected too
-            std::unique_lock<std::mutex> completedLock(workQueueLock_);
-            workCompletedSignal_.notify_one();
+}
+
+void PhysicsController::updateSleepStates() {
+    auto &active = bodies_.active();
+    // Walk backwards - sleeping a body moves the last active entry into its place
+    for (uint k = static_cast<uint>(active.size()); k-- > 0;) {
+        auto index = active[k];
+        if (bodies_.sleepFrames[index] < PHYS_SLEEP_FRAMES) continue;
+#if (PHYS_TRACE == 1)
+        printf("PhysicsController::updateSleepStates: %s is going to sleep\n",
+            bodies_.target[index]->objectName().c_str());
+#endif
+        bodies_.prevPos[index] = bodies_.stepPos[index];
+        bodies_.sleep(index);
+        // Leaves the active list, so the PUBLISH batches would miss this step's move
+        settledBodies_.push_back(bodies_.handleOf(index));
+    }
+}
+
+void PhysicsController::runBatch(PhysicsWorkType workType, uint begin, uint end) {
+#if (PHYS_TRACE == 1)
+    printf("PhysicsController::runBatch: Running batch [%u, %u), work type [%d]\n", begin, end, workType);
+#endif
+    // Per-thread scratch buffers for the collision stage, reused across batches
+    thread_local CollisionScratch scratch;
+    // Keeps bodies from being removed out from under the batch
+    std::shared_lock<std::shared_mutex> objLock(physicsObjectQueueLock_);
+    auto &active = bodies_.active();
+    switch (workType) {
+        case PhysicsWorkType::POSITION:
+            // Position function defined here...
+            /**         1    2
+             *  D(t) =  _ a t  + v t + x
+             *          2
+             */
+            updatePositions(begin, end);
+            break;
+        case PhysicsWorkType::COLLISION:
+            for (uint k = begin; k < end; ++k) {
+                collideBody(active[k], &scratch);
+            }
+            // One merge per batch rather than one per contact
+            if (!scratch.contacts.empty()) mergeContacts(&scratch.contacts);
+            if (!scratch.solverBodies.empty()) mergeSolverBodies(&scratch.solverBodies);
+            flushCounters(&scratch);
+            break;
+        case PhysicsWorkType::WAKE:
+            for (uint k = begin; k < end; ++k) {
+                collideBody(wokenBodies_[k], &scratch);
+            }
+            if (!scratch.contacts.empty()) mergeContacts(&scratch.contacts);
+            if (!scratch.solverBodies.empty()) mergeSolverBodies(&scratch.solverBodies);
+            flushCounters(&scratch);
+            break;
+        case PhysicsWorkType::SOLVE: {
+            bool moved = false;
+            for (uint k = begin; k < end; ++k) {
+                moved |= solveBody(k, 0 == solverPass_);
+            }
+            if (moved) solverMoved_.store(true, std::memory_order_relaxed);
+            break;
         }
+        case PhysicsWorkType::CORRECT:
+            for (uint k = begin; k < end; ++k) {
+                applyCorrection(solverBodies_[k]);
+            }
+            break;
+        case PhysicsWorkType::FINALIZE:
+            for (uint k = begin; k < end; ++k) {
+                updateFinalize(active[k]);  // Can use an assert to check for collisions post-update
+            }
+            break;
+        case PhysicsWorkType::ADOPT:
+            adoptTargetPositions(begin, end);
+            break;
+        case PhysicsWorkType::PUBLISH:
+            publishTargets(begin, end);
+            break;
+        default:
+            printf("HORRIBLE BADNESS\n");
+            break;
     }
-    // Might not be necessary, but doing this to be safe for now
-    freeWorkers_ += 1;
-    assert(freeWorkers_ <= threadNum_);
-    return PhysicsResult::OK;
 }
 
 /* Physics Proposal
@@ -303,54 +746,135 @@ TLDR; should somewhat resemble reality
  * @param gameObject to add to the list
  * @return PhysicsResult returns PHYS_OK
  */
-PhysicsResult PhysicsController::addSceneObject(SceneObject *sceneObject, PhysicsParams params) {
-    // Retrieve the exclusive lock for the game object list
-    std::unique_lock<std::shared_mutex> scopeLock(physicsObjectQueueLock_);
-
-    // Create a new physics profile for the object
-    auto physicsObject = std::make_shared<PhysicsObject>();
-    auto poPtr = physicsObject.get();
-    poPtr->target = sceneObject;
-    poPtr->position = sceneObject->getPosition();
-    poPtr->prevPos = vec3(0);
-    poPtr->velocity = vec3(0);
-    poPtr->acceleration = vec3(0);
-    poPtr->isKinematic = params.isKinematic;
-    poPtr->obeyGravity = params.obeyGravity;
-    poPtr->impulse = vec3(0);
-    poPtr->elasticity = params.elasticity;
-    poPtr->mass = params.mass;
-    poPtr->runningTime = 0.0;
-    poPtr->gravTime = 0.0;
-    poPtr->targetCollider = dynamic_cast<ColliderExt *>(sceneObject);
-
-    // Add the object to the physics object list
+PhysicsHandle PhysicsController::addSceneObject(SceneObject *sceneObject, PhysicsParams params) {
     assert(!sceneObject->objectName().empty());
-    physicsObjects_[sceneObject->objectName()] = physicsObject;
-    return PhysicsResult::OK;
+    std::unique_lock<std::mutex> scopeLock(pendingBodyLock_);
+    // Re-adding an object replaces its old body
+    auto nit = bodyNames_.find(sceneObject->objectName());
+    if (nit != bodyNames_.end()) {
+        pendingRemoves_.push_back(nit->second);
+    }
+    // Pending adds land before pending removes, so the store hands out the handles in this order
+    auto handle = bodies_.peekHandle(static_cast<uint>(pendingAdds_.size()));
+    pendingAdds_.push_back({ sceneObject, params, handle });
+    // Add the object to the name lookup
+    bodyNames_[sceneObject->objectName()] = handle;
+    return handle;
 }
 
 PhysicsResult PhysicsController::removeSceneObject(string objectName) {
-    auto res = PhysicsResult::OK;
-    std::unique_lock<std::shared_mutex> scopeLock(physicsObjectQueueLock_);
-    auto poit = physicsObjects_.find(objectName);
-    if (poit != physicsObjects_.end()) {
-        printf("PhysicsController::removeSceneObject: Deleting object %s\n", objectName.c_str());
-        physicsObjects_.erase(poit);
-    } else {
+    std::unique_lock<std::mutex> updateLock(updateLock_);
+    // The steps in flight and the next publish read the target, and callers destroy it right after removing it
+    jobSystem_->wait(updateJob_);
+    std::unique_lock<std::shared_mutex> queueLock(physicsObjectQueueLock_);
+    // Lands a body added since the last update too, so it can be removed from the store below
+    applyPendingBodies();
+    std::unique_lock<std::mutex> scopeLock(pendingBodyLock_);
+    auto nit = bodyNames_.find(objectName);
+    if (nit == bodyNames_.end()) {
         fprintf(stderr,
             "PhysicsController::removeSceneObject: %s is not present in the physics controller!\n",
         objectName.c_str());
-        res = PhysicsResult::FAILURE;
+        return PhysicsResult::FAILURE;
     }
-    return res;
+    printf("PhysicsController::removeSceneObject: Deleting object %s\n", objectName.c_str());
+    removeBody(nit->second);
+    bodyNames_.erase(nit);
+    return PhysicsResult::OK;
+}
+
+PhysicsResult PhysicsController::removeSceneObject(PhysicsHandle handle) {
+    std::unique_lock<std::mutex> updateLock(updateLock_);
+    jobSystem_->wait(updateJob_);
+    std::unique_lock<std::shared_mutex> queueLock(physicsObjectQueueLock_);
+    applyPendingBodies();
+    std::unique_lock<std::mutex> scopeLock(pendingBodyLock_);
+    auto nit = std::find_if(bodyNames_.begin(), bodyNames_.end(), [handle](const auto &entry) {
+        return entry.second == handle;
+    });
+    if (nit == bodyNames_.end()) {
+        fprintf(stderr, "PhysicsController::removeSceneObject: Handle %u is not present in the physics controller!\n",
+            handle);
+        return PhysicsResult::FAILURE;
+    }
+    printf("PhysicsController::removeSceneObject: Deleting object %s\n", nit->first.c_str());
+    removeBody(handle);
+    bodyNames_.erase(nit);
+    return PhysicsResult::OK;
+}
+
+void PhysicsController::removeBody(PhysicsHandle handle) {
+    auto index = bodies_.indexOf(handle);
+    if (PHYS_INVALID_INDEX == index) return;
+    // Reports waiting for sync must not hand the target out once its owner is free to destroy it
+    auto target = bodies_.target[index];
+    for (auto &report : pendingReports_) {
+        for (auto &contact : report.contacts) {
+            if (contact.bodyObject == target) contact.bodyObject = nullptr;
+            if (contact.otherObject == target) contact.otherObject = nullptr;
+        }
+    }
+    bodies_.remove(handle);
+}
+
+void PhysicsController::applyPendingBodies() {
+    std::unique_lock<std::mutex> scopeLock(pendingBodyLock_);
+    for (auto &pending : pendingAdds_) {
+        auto sceneObject = pending.object;
+        auto &params = pending.params;
+        // Create a new physics profile for the object
+        auto handle = bodies_.add(sceneObject, dynamic_cast<ColliderExt *>(sceneObject));
+        assert(handle == pending.handle);
+        auto index = bodies_.indexOf(handle);
+        bodies_.isKinematic[index] = params.isKinematic;
+        bodies_.obeyGravity[index] = params.obeyGravity;
+        bodies_.elasticity[index] = params.elasticity;
+        bodies_.mass[index] = params.mass;
+        bodies_.continuous[index] = params.continuousCollision;
+        bodies_.mesh[index] = params.mesh;
+        if (nullptr != params.mesh && params.isKinematic) {
+            fprintf(stderr, "PhysicsController::addSceneObject: Mesh collider on %s is static, ignoring isKinematic\n",
+                sceneObject->objectName().c_str());
+            bodies_.isKinematic[index] = false;
+            params.isKinematic = false;
+        }
+        auto collider = bodies_.collider[index] ? bodies_.collider[index]->getCollider() : nullptr;
+        if (params.collisionLayer || params.collisionMask) {
+            if (nullptr != collider) {
+                if (params.collisionLayer) collider->setLayer(params.collisionLayer);
+                if (params.collisionMask) collider->setMask(params.collisionMask);
+            } else {
+                fprintf(stderr,
+                    "PhysicsController::addSceneObject: %s has no collider to set the collision filter on\n",
+                    sceneObject->objectName().c_str());
+            }
+        }
+        if (nullptr != params.mesh && nullptr == collider) {
+            fprintf(stderr, "PhysicsController::addSceneObject: %s needs a collider to bound its mesh collider\n",
+                sceneObject->objectName().c_str());
+        }
+        // Static bodies can never move on their own, so keep them out of the pipeline until something wakes them
+        if (!params.isKinematic && !params.obeyGravity) bodies_.sleep(index);
+    }
+    pendingAdds_.clear();
+    for (auto handle : pendingRemoves_) {
+        removeBody(handle);
+    }
+    pendingRemoves_.clear();
 }
 
 std::shared_ptr<PhysicsObject> PhysicsController::getPhysicsObject(string objectName) {
-    auto poit = physicsObjects_.find(objectName);
+    {
+        // Land the bodies added or removed since the last update, so the accessor refers to a body in the store
+        std::unique_lock<std::mutex> updateLock(updateLock_);
+        jobSystem_->wait(updateJob_);
+        std::unique_lock<std::shared_mutex> scopeLock(physicsObjectQueueLock_);
+        applyPendingBodies();
+    }
+    auto handle = getHandle(objectName);
     std::shared_ptr<PhysicsObject> res;
-    if (poit != physicsObjects_.end()) {
-        res = poit->second;
+    if (PHYS_INVALID_HANDLE != handle) {
+        res = std::make_shared<PhysicsObject>(&bodies_, handle);
     } else {
         fprintf(stderr,
             "PhysicsController::getPhysicsObject: %s does not exist in phys controller\n",
@@ -359,38 +883,30 @@ std::shared_ptr<PhysicsObject> PhysicsController::getPhysicsObject(string object
     return res;
 }
 
-PhysicsController::PhysicsController(uint threadNum) : threadNum_{threadNum} {
+PhysicsHandle PhysicsController::getHandle(string objectName) {
+    std::unique_lock<std::mutex> scopeLock(pendingBodyLock_);
+    auto nit = bodyNames_.find(objectName);
+    return (nit != bodyNames_.end()) ? nit->second : PHYS_INVALID_HANDLE;
+}
+
+PhysicsController::PhysicsController(uint threadNum) :
+    ownedJobSystem_ { std::make_unique<JobSystem>(std::min<uint>(threadNum, PHYS_MAX_THREADS)) },
+    jobSystem_ { ownedJobSystem_.get() } {
     printf("PhysicsController::PhysicsController: Creating with %d threads\n", threadNum);
-    if (threadNum_ > PHYS_MAX_THREADS) return;
-    // Set the initial free workers to threadNum
-    freeWorkers_ = threadNum;
-    // Create thread pool for physics calculations
-    for (uint i = 0; i < threadNum_; ++i) {
-        threads_.emplace_back(&PhysicsController::doWork, this);
-    }
-    printf("PhysicsController::PhysicsController: Exit\n");
+}
+
+PhysicsController::PhysicsController(JobSystem *jobSystem) : jobSystem_ { jobSystem } {
+    assert(jobSystem_ != nullptr);
+    printf("PhysicsController::PhysicsController: Using shared job system with %u threads\n",
+        jobSystem_->threadCount());
 }
 
 PhysicsController::~PhysicsController() {
-    std::unique_lock<std::mutex> scopeLock(workQueueLock_);
     printf("PhysicsController::~PhysicsController\n");
     shutdown();  // Mark the scheduler to shutdown
-    // Thread safety for this variable probably isn't super important...
-    auto deathMsg = std::make_shared<PhysicsObject>();
-    deathMsg.get()->workType = PhysicsWorkType::DIE;
-    // When we end, send kill signal to threads and join
-    for (uint i = 0; i < threadNum_; ++i) {
-        printf("PhysicsController::~PhysicsController: Sending kill to worker queue...\n");
-        workQueue_.push(deathMsg);
-    }
-    workAvailableSignal_.notify_all();
-    scopeLock.unlock();
-    int tCount = 0;
-    for (auto &thread : threads_) {
-        printf("PhysicsController::~PhysicsController: Joining worker thread %d\n",
-            tCount++);
-        thread.join();
-    }
+    // Batches reference this controller, so let any in flight update and stage drain before tearing down
+    jobSystem_->wait(updateJob_);
+    jobSystem_->wait(stageJob_);
 }
 
 /**
@@ -403,84 +919,411 @@ PhysicsController::~PhysicsController() {
  * force (acceleration * mass), as well as other things.
  *
  * COLLISION - This is the second step in the pipeline. After the positions of all objects has been updated, we can
- * start checking for collisions with each object. This is going to be a very heavy step. We're going to check for
- * collisions against all of the other objects in the scene. This can be optimized using object distances later, but for
- * V1 this is OK. We check for collisions and then report any collisions via physics reports. Subscribers to physics events
- * will be notified.
+ * start checking for collisions with each object. Before any collision work is queued, every object with a collider is
+ * inserted into a spatial hash broadphase, and each kinematic object is only checked against the objects sharing its
+ * cells. The brute force (every object vs every object) check can be selected with setBroadphase for comparison. We
+ * check for collisions and then report any collisions via physics reports. Subscribers to physics events will be
+ * notified.
  *
  * FINALIZE - This stage is going to handle the physics behind object collisions between two objects, We can calculate
- * impulse or whatever else we want here, and then update the object's acceleration/velocity/position again. When
- * objects collide here, we want to send those objects BACK into the POSITION workload. This will also require checking
- * for COLLISIONS again, and then finalizing again... We can run into infiite loops here if we're possible, but again
- * that's a V2 issue :)
+ * impulse or whatever else we want here, and then update the object's acceleration/velocity/position again.
+ *
+ * SOLVE - Each body only answers every contact once during COLLISION, so bodies pushed into a third body (stacks,
+ * crowds, crushes) are left sinking into it. The contact solver makes up to solverIterations_ Jacobi passes over the
+ * box contacts found this step. Every pass works out each body's correction from the current positions (SOLVE) and
+ * then applies them all at once (CORRECT), so a body only ever writes to its own state and no locks are needed.
  *
- * SUBMIT - This may not actually be a separate step, but we'll need to see how this turns out. We want to make sure we
- * report all of the physics events to their subscribers. Maybe we'll only submit physics reports at this step?
+ * SUBMIT - Each COLLISION batch records the contact pairs it found in a per-thread buffer and merges them into the
+ * step's contact list once. After FINALIZE the list is compared with last step's list, and every begin, persist and
+ * end event is queued as one PhysicsReport. Reports are delivered to each subscriber by sync, along with the targets.
  *
  * @return PhysicsResult
  */
 PhysicsResult PhysicsController::schedulePosition() {
     if (shutdown_) return PhysicsResult::SHUTDOWN;
     std::unique_lock<std::shared_mutex> scopeLock(physicsObjectQueueLock_);
-    workQueueLock_.lock();
     // Run the initial POSITION pipeline step here with all objects - maybe check for kinematic
-    for (auto physObjEntry : physicsObjects_) {
-        physObjEntry.second.get()->workType = PhysicsWorkType::POSITION;
-        workQueue_.push(physObjEntry.second);
-    }
-    workAvailableSignal_.notify_all();
-    workQueueLock_.unlock();
+    scheduleBatches(PhysicsWorkType::POSITION);
     return PhysicsResult::OK;
 }
 
 PhysicsResult PhysicsController::scheduleCollision() {
     if (shutdown_) return PhysicsResult::SHUTDOWN;
     std::unique_lock<std::shared_mutex> scopeLock(physicsObjectQueueLock_);
-    workQueueLock_.lock();
-    // Run the initial POSITION pipeline step here with all objects - maybe check for kinematic
-    for (auto physObjEntry : physicsObjects_) {
-        physObjEntry.second->workType = PhysicsWorkType::COLLISION;
-        workQueue_.push(physObjEntry.second);
-    }
-    workAvailableSignal_.notify_all();
-    workQueueLock_.unlock();
+    // Positions are final for this pass, so the broadphase can be rebuilt before any collision work starts
+    buildSleepingBroadphase();
+    buildBroadphase();
+    scheduleBatches(PhysicsWorkType::COLLISION);
     return PhysicsResult::OK;
 }
 
 PhysicsResult PhysicsController::scheduleFinalize() {
     if (shutdown_) return PhysicsResult::SHUTDOWN;
     std::unique_lock<std::shared_mutex> scopeLock(physicsObjectQueueLock_);
-    workQueueLock_.lock();
-    // Run the initial POSITION pipeline step here with all objects - maybe check for kinematic
-    for (auto physObjEntry : physicsObjects_) {
-        physObjEntry.second.get()->workType = PhysicsWorkType::FINALIZE;
-        workQueue_.push(physObjEntry.second);
-    }
-    workAvailableSignal_.notify_all();
-    workQueueLock_.unlock();
+    scheduleBatches(PhysicsWorkType::FINALIZE);
     return PhysicsResult::OK;
 }
 
+void PhysicsController::scheduleBatches(PhysicsWorkType workType) {
+    // Only awake bodies are queued, so the cost of a stage scales with the number of awake bodies
+    uint count = bodies_.activeCount();
+    if (workType == PhysicsWorkType::WAKE) {
+        count = static_cast<uint>(wokenBodies_.size());
+    } else if (workType == PhysicsWorkType::ADOPT) {
+        count = bodies_.size();
+    } else if (workType == PhysicsWorkType::SOLVE || workType == PhysicsWorkType::CORRECT) {
+        count = static_cast<uint>(solverBodies_.size());
+    }
+    // One contiguous range of the body list per worker keeps lock traffic at one acquire per thread per stage
+    stageJob_ = jobSystem_->parallelFor(count, 0, [this, workType](uint begin, uint end) {
+        runBatch(workType, begin, end);
+    });
+}
+
+void PhysicsController::updateBodyBounds(uint index, vec3 *minBound, vec3 *maxBound) {
+    auto collider = bodies_.collider[index]->getCollider();
+    // The collider box is computed once per collision stage and shared by the broadphase and the narrow phase. Built
+    // from the simulated position, since the target only catches up when the step is published.
+    auto currentPos = bodies_.stepPos[index];
+    auto tm = glm::translate(mat4(1.0f), currentPos);
+    auto sm = glm::scale(mat4(1.0f), bodies_.scale[index]);
+    auto center = ColliderObject::createCenter(tm, sm, collider);
+    auto rawOffset = vec3(ColliderObject::createOffset(tm, sm, center, collider));
+    // Kept relative to the position so the narrow phase can place the box without any matrix math
+    bodies_.colliderCenter[index] = vec3(center) - currentPos;
+    bodies_.colliderOffset[index] = rawOffset;
+    auto offset = glm::abs(rawOffset);
+    *minBound = vec3(center) - offset;
+    *maxBound = vec3(center) + offset;
+    // Query with the bounds swept back to the previous position - edge points push objects back that way
+    auto prevOffset = bodies_.prevPos[index] - currentPos;
+    bodies_.boundsMin[index] = glm::min(*minBound, *minBound + prevOffset);
+    bodies_.boundsMax[index] = glm::max(*maxBound, *maxBound + prevOffset);
+}
+
+// True when the body has a collider the collision stage can test against
+#define HAS_COLLIDER(index) (nullptr != bodies_.collider[index] && nullptr != bodies_.collider[index]->getCollider())
+
+void PhysicsController::buildSleepingBroadphase() {
+    if (sleepingBroadphaseVersion_ == bodies_.sleepVersion()) return;
+    sleepingBroadphaseVersion_ = bodies_.sleepVersion();
+    sleepingCollisionBodies_.clear();
+    sleepingBroadphase_.clear();
+    vec3 minBound, maxBound;
+    for (uint i = 0; i < bodies_.size(); ++i) {
+        if (!bodies_.asleep(i) || !HAS_COLLIDER(i)) continue;
+        updateBodyBounds(i, &minBound, &maxBound);
+        if (broadphaseMode_ == PhysicsBroadphase::SPATIAL_HASH) {
+            sleepingBroadphase_.insert(static_cast<uint>(sleepingCollisionBodies_.size()), minBound, maxBound);
+        }
+        sleepingCollisionBodies_.push_back(i);
+    }
+}
+
+void PhysicsController::buildBroadphase() {
+    collisionBodies_.clear();
+    broadphase_.clear();
+    for (auto i : bodies_.active()) {
+        if (HAS_COLLIDER(i)) collisionBodies_.push_back(i);
+    }
+    // The active list is unordered - sort it so candidates are always visited in ascending body order
+    std::sort(collisionBodies_.begin(), collisionBodies_.end());
+    vec3 minBound, maxBound;
+    for (uint hashIndex = 0; hashIndex < collisionBodies_.size(); ++hashIndex) {
+        updateBodyBounds(collisionBodies_[hashIndex], &minBound, &maxBound);
+        if (broadphaseMode_ == PhysicsBroadphase::SPATIAL_HASH) {
+            broadphase_.insert(hashIndex, minBound, maxBound);
+        }
+    }
+    if (broadphaseMode_ == PhysicsBroadphase::BRUTE_FORCE) {
+        allCollisionBodies_.clear();
+        std::merge(collisionBodies_.begin(), collisionBodies_.end(), sleepingCollisionBodies_.begin(),
+            sleepingCollisionBodies_.end(), std::back_inserter(allCollisionBodies_));
+    }
+}
+
+void PhysicsController::collectCandidates(uint index, CollisionScratch *scratch) {
+    auto &candidates = scratch->candidates;
+    auto &sleepingCandidates = scratch->sleepingCandidates;
+    candidates.clear();
+    sleepingCandidates.clear();
+    // Only kinematic bodies with colliders do anything in the collision stage
+    if (!bodies_.isKinematic[index] || !HAS_COLLIDER(index)) return;
+    broadphase_.query(bodies_.boundsMin[index], bodies_.boundsMax[index], &scratch->indices);
+    // Collision bodies are in ascending body order, so the candidates stay sorted
+    for (auto hashIndex : scratch->indices) {
+        candidates.push_back(collisionBodies_[hashIndex]);
+    }
+    sleepingBroadphase_.query(bodies_.boundsMin[index], bodies_.boundsMax[index], &scratch->indices);
+    if (scratch->indices.empty()) return;
+    for (auto hashIndex : scratch->indices) {
+        sleepingCandidates.push_back(sleepingCollisionBodies_[hashIndex]);
+    }
+    // Interleave the sleeping candidates so both lists are visited in one ascending pass
+    auto awakeCount = candidates.size();
+    candidates.insert(candidates.end(), sleepingCandidates.begin(), sleepingCandidates.end());
+    std::inplace_merge(candidates.begin(), candidates.begin() + awakeCount, candidates.end());
+}
+
+void PhysicsController::setBroadphase(PhysicsBroadphase mode) {
+    std::unique_lock<std::shared_mutex> scopeLock(physicsObjectQueueLock_);
+    broadphaseMode_ = mode;
+    broadphase_.clear();
+    // Force the sleeping bodies to be rebuilt for the new mode
+    sleepingBroadphaseVersion_ = bodies_.sleepVersion() - 1;
+}
+
+void PhysicsController::setSolverIterations(uint iterations) {
+    std::unique_lock<std::shared_mutex> scopeLock(physicsObjectQueueLock_);
+    solverIterations_ = iterations;
+}
+
+void PhysicsController::setBroadphaseCellSize(float cellSize) {
+    std::unique_lock<std::shared_mutex> scopeLock(physicsObjectQueueLock_);
+    broadphase_.setCellSize(cellSize);
+    sleepingBroadphase_.setCellSize(cellSize);
+    sleepingBroadphaseVersion_ = bodies_.sleepVersion() - 1;
+}
+
 PhysicsResult PhysicsController::waitPipelineComplete() {
-    // Is it okay to use the workCompletedSignal here instead of the work available signal???
-    std::unique_lock<std::mutex> scopeLock(workQueueLock_);
-    workCompletedSignal_.wait(scopeLock, [this]() { return isPipelineComplete() || shutdown_; });
+    // The waiting thread helps run queued batches instead of sleeping
+    jobSystem_->wait(stageJob_);
     return shutdown_ ? PhysicsResult::SHUTDOWN : PhysicsResult::OK;
 }
 
 void PhysicsController::update() {
+    update(FrameContext::fromDeltaTime(deltaTime));
+}
+
+void PhysicsController::update(const FrameContext &frame) {
+    updateAsync(frame);
+    sync();
+}
+
+void PhysicsController::updateAsync() {
+    updateAsync(FrameContext::fromDeltaTime(deltaTime));
+}
+
+void PhysicsController::updateAsync(const FrameContext &frame) {
 #if (PHYS_TRACE == 1)
-    printf("PhysicsSController::update: deltaTime %f\n", deltaTime);
+    printf("PhysicsSController::updateAsync: frame %lu, deltaTime %f\n", static_cast<unsigned long>(frame.frameIndex),
+        frame.deltaTime);
 #endif
     // Stop updating when shutdown received
+    if (shutdown_) return;
+    // Only one update runs at a time, so land the last one first
+    sync();
+    // Copied so commands applied below and between updates see the time of the frame that applies them
+    frameDeltaTime_ = frame.deltaTime;
+    std::unique_lock<std::mutex> updateLock(updateLock_);
+    // Reset under the lock, since another thread's sync can still be publishing the last update's stats
+    stageTiming_ = PhysicsStageTiming();
+    jobsBefore_ = jobSystem_->getStats();
+    pairsTested_ = 0;
+    contactsFound_ = 0;
+    solverPasses_ = 0;
+    {
+        // Bodies and changes added since the last update land before anything moves
+        std::unique_lock<std::shared_mutex> scopeLock(physicsObjectQueueLock_);
+        applyPendingBodies();
+        applyQueuedCommands();
+        scheduleBatches(PhysicsWorkType::ADOPT);
+    }
+    waitPipelineComplete();
+    {
+        std::unique_lock<std::shared_mutex> scopeLock(physicsObjectQueueLock_);
+        // Requests arrive in whatever order the batches ran, so sort them to keep the active list the same
+        std::sort(wakeRequests_.begin(), wakeRequests_.end());
+        for (auto index : wakeRequests_) {
+            bodies_.wake(index);
+        }
+        wakeRequests_.clear();
+    }
+    uint substeps = 1;
+    if (0 != deterministicHz_ || 0 == fixedHz_) {
+        // Deterministic mode never looks at the frame time, so replays do not depend on how fast they are played
+        stepTime_ = 0 != deterministicHz_ ? 1.0f / deterministicHz_ : CAP_TIME(frame.deltaTime);
+        interpolated_ = false;
+    } else {
+        float fixedStep = 1.0f / fixedHz_;
+        accumulator_ += frame.deltaTime;
+        substeps = 0;
+        while (accumulator_ >= fixedStep && substeps < maxSubsteps_) {
+            accumulator_ -= fixedStep;
+            substeps++;
+        }
+        // Too far behind to catch up - drop the backlog instead of making the next frame even slower
+        if (accumulator_ >= fixedStep) accumulator_ = 0.0;
+        alpha_ = static_cast<float>(accumulator_ / fixedStep);
+        stepTime_ = fixedStep;
+        interpolated_ = true;
+    }
+    lastSubsteps_ = substeps;
+#if (PHYS_TRACE == 1)
+    printf("PhysicsController::updateAsync: %u substeps, alpha %f\n", substeps, alpha_);
+#endif
+    // The steps only read the body store, with the scale of each target copied by ADOPT above, so the caller is free
+    // to render the last published positions meanwhile. The job does not take updateLock_ - game threads queue
+    // bodies and changes until the next update lands them, and removals wait for the job.
+    updateJob_ = jobSystem_->submit([this, substeps]() {
+        for (uint i = 0; i < substeps; ++i) {
+            step();
+        }
+        publishQueryWorld();
+    });
+}
+
+PhysicsResult PhysicsController::sync() {
+    vector<PhysicsReport> reports;
+    {
+        std::unique_lock<std::mutex> updateLock(updateLock_);
+        if (!updateJob_) return shutdown_ ? PhysicsResult::SHUTDOWN : PhysicsResult::OK;
+        // The waiting thread helps run the steps instead of sleeping
+        jobSystem_->wait(updateJob_);
+        updateJob_.reset();
+        {
+            std::unique_lock<std::shared_mutex> scopeLock(physicsObjectQueueLock_);
+            scheduleBatches(PhysicsWorkType::PUBLISH);
+        }
+        waitPipelineComplete();
+        std::unique_lock<std::shared_mutex> scopeLock(physicsObjectQueueLock_);
+        for (auto handle : settledBodies_) {
+            auto index = bodies_.indexOf(handle);
+            // Woken again or removed since it went to sleep - published above or gone
+            if (PHYS_INVALID_INDEX == index || !bodies_.asleep(index)) continue;
+            publishTarget(index);
+        }
+        settledBodies_.clear();
+        scopeLock.unlock();
+        // Taken before the lock is released, since the next updateAsync resets the counters and the next steps
+        // push new reports
+        publishStats(jobsBefore_);
+        reports.swap(pendingReports_);
+    }
+    // Delivered here rather than from the steps, so callbacks run on the thread reading the results
+    vector<PhysicsSubscriber> subscribers;
+    {
+        std::unique_lock<std::mutex> scopeLock(subscriberLock_);
+        subscribers = subscribers_;
+    }
+    for (auto &report : reports) {
+        for (auto &subscriber : subscribers) {
+            subscriber.callback(report);
+        }
+    }
+    return shutdown_ ? PhysicsResult::SHUTDOWN : PhysicsResult::OK;
+}
+
+void PhysicsController::step() {
+    auto stageStart = std::chrono::steady_clock::now();
+    // Returns the milliseconds since the last call, used to time each stage
+    auto lapMs = [&stageStart]() {
+        auto now = std::chrono::steady_clock::now();
+        double elapsed = std::chrono::duration<double, std::milli>(now - stageStart).count();
+        stageStart = now;
+        return elapsed;
+    };
+    {
+        // Contacts are only worth recording when someone will receive them
+        std::unique_lock<std::mutex> scopeLock(subscriberLock_);
+        recordContacts_ = !subscribers_.empty();
+    }
     // Physics pipeline updated here...
     schedulePosition();
     waitPipelineComplete();
+    stageTiming_.positionMs += lapMs();
     scheduleCollision();
     waitPipelineComplete();
-    // Need to loop here for recursive collisions? Maybe cap the loop?
+    wakeTouchedBodies();
+    stageTiming_.collisionMs += lapMs();
     scheduleFinalize();
     waitPipelineComplete();
+    stageTiming_.finalizeMs += lapMs();
+    // The COLLISION stage answers each contact once, so settle whatever is still sinking into something
+    solveContacts();
+    {
+        std::unique_lock<std::shared_mutex> scopeLock(physicsObjectQueueLock_);
+        updateSleepStates();
+    }
+    stageTiming_.solveMs += lapMs();
+    submitContacts();
+    stageTiming_.submitMs += lapMs();
+#if (PHYS_TRACE == 1)
+    printf("PhysicsController::step: position %fms, collision %fms, finalize %fms, solve %fms, submit %fms\n",
+        stageTiming_.positionMs, stageTiming_.collisionMs, stageTiming_.finalizeMs, stageTiming_.solveMs,
+        stageTiming_.submitMs);
+#endif
+}
+
+void PhysicsController::setFixedRate(uint hz, uint maxSubsteps) {
+    std::unique_lock<std::mutex> updateLock(updateLock_);
+    // The steps in flight read the stepping mode
+    jobSystem_->wait(updateJob_);
+    std::unique_lock<std::shared_mutex> scopeLock(physicsObjectQueueLock_);
+    if (0 == fixedHz_ && hz > 0) {
+        // Start from the current positions so the first interpolated frame does not jump
+        for (uint i = 0; i < bodies_.size(); ++i) {
+            bodies_.prevPos[i] = bodies_.stepPos[i];
+        }
+    } else if (0 == hz && interpolated_) {
+        // Leave every target at its simulated position
+        interpolated_ = false;
+        for (uint i = 0; i < bodies_.size(); ++i) {
+            adoptTargetPosition(i);
+            publishTarget(i);
+        }
+    }
+    fixedHz_ = hz;
+    maxSubsteps_ = maxSubsteps > 0 ? maxSubsteps : 1;
+    accumulator_ = 0.0;
+    alpha_ = 0.0f;
+}
+
+void PhysicsController::setDeterministic(uint hz) {
+    std::unique_lock<std::mutex> updateLock(updateLock_);
+    jobSystem_->wait(updateJob_);
+    std::unique_lock<std::shared_mutex> scopeLock(physicsObjectQueueLock_);
+    if (hz > 0 && interpolated_) {
+        // Leave every target at its simulated position, since deterministic steps are never interpolated
+        interpolated_ = false;
+        for (uint i = 0; i < bodies_.size(); ++i) {
+            adoptTargetPosition(i);
+            publishTarget(i);
+        }
+    }
+    deterministicHz_ = hz;
+    accumulator_ = 0.0;
+    alpha_ = 0.0f;
+}
+
+// FNV-1a over the raw bytes of a value, so -0.0 and 0.0 or two NaNs with different payloads hash differently
+template <typename T>
+static inline void hashBytes(const T &value, uint64_t *hash) {
+    auto bytes = reinterpret_cast<const unsigned char *>(&value);
+    for (size_t i = 0; i < sizeof(T); ++i) {
+        *hash ^= bytes[i];
+        *hash *= 1099511628211ull;
+    }
+}
+
+uint64_t PhysicsController::getStateHash() {
+    std::shared_lock<std::shared_mutex> scopeLock(physicsObjectQueueLock_);
+    auto &b = bodies_;
+    uint64_t hash = 14695981039346656037ull;
+    hashBytes(stepCount_, &hash);
+    for (uint i = 0; i < b.size(); ++i) {
+        hashBytes(b.handleOf(i), &hash);
+        hashBytes(physicsPosition(i), &hash);
+        hashBytes(b.position[i], &hash);
+        hashBytes(b.velocity[i], &hash);
+        hashBytes(b.acceleration[i], &hash);
+        hashBytes(b.runningTime[i], &hash);
+        hashBytes(b.gravTime[i], &hash);
+        hashBytes(b.sleepFrames[i], &hash);
+        uint8_t asleep = b.asleep(i) ? 1 : 0;
+        hashBytes(asleep, &hash);
+    }
+    return hash;
 }
 
 PhysicsResult PhysicsController::shutdown() {
@@ -491,114 +1334,266 @@ PhysicsResult PhysicsController::shutdown() {
     return PhysicsResult::OK;
 }
 
-PhysicsResult PhysicsController::setPosition(string objectName, vec3 position) {
-    std::unique_lock<std::shared_mutex> scopeLock(physicsObjectQueueLock_);
-    auto result = PhysicsResult::FAILURE;
-    auto poit = physicsObjects_.find(objectName);
-    if (poit != physicsObjects_.end()) {
-        assert(poit->second->target != nullptr);
-        poit->second->target->setPosition(position);
-        poit->second->fullFlush();
-        result = PhysicsResult::OK;
-    } else {
-        printf("PhysicsController::setPosition: %s not found", objectName.c_str());
+void PhysicsController::applyCommand(uint index, const PhysicsCommand &command) {
+    auto &value = command.value;
+    bodies_.wake(index);
+    // A body moved while it slept was never adopted, so catch up before flushing from its position
+    adoptTargetPosition(index);
+    switch (command.type) {
+        case PhysicsCommandType::SET_POSITION:
+            assert(bodies_.target[index] != nullptr);
+            bodies_.target[index]->setPosition(value);
+            // Jump straight there rather than interpolating towards it
+            bodies_.prevPos[index] = bodies_.target[index]->getPosition();
+            bodies_.stepPos[index] = bodies_.prevPos[index];
+            bodies_.renderPos[index] = bodies_.prevPos[index];
+            fullFlush(index);
+            break;
+        case PhysicsCommandType::SET_VELOCITY:
+            // On velocity change, flush object position and reset time
+            fullFlush(index);
+            bodies_.velocity[index] = value;
+            break;
+        case PhysicsCommandType::SET_ACCELERATION:
+            // On acceleration change, flush object position and reset time
+            fullFlush(index);
+            bodies_.acceleration[index] = value;
+            break;
+        case PhysicsCommandType::APPLY_FORCE:
+            fullFlush(index);
+            // Check if the mass is zero
+            if (0.0 != bodies_.mass[index]) {
+                bodies_.acceleration[index] += (value / vec3(bodies_.mass[index]));
+            } else {
+                fprintf(stderr,
+                    "PhysicsController::applyForce: Failed to apply force! Target object %s has no mass set!",
+                    bodies_.target[index]->objectName().c_str());
+            }
+            break;
+        case PhysicsCommandType::APPLY_INSTANT_FORCE:
+            fullFlush(index);
+            // Check if the mass is zero
+            if (0.0 != bodies_.mass[index]) {
+                // The force is spread over one step
+                float cappedTime = deterministicHz_ ? 1.0f / deterministicHz_ :
+                    fixedHz_ ? 1.0f / fixedHz_ : CAP_TIME(frameDeltaTime_);
+                bodies_.velocity[index] += vec3(0.5f) * (value / vec3(bodies_.mass[index])) * vec3(cappedTime);
+                printf("PhysicsController::applyInstantForce: Capped time %f\n", cappedTime);
+            } else {
+                fprintf(stderr,
+                    "PhysicsController::applyForce: Failed to apply force! Target object %s has no mass set!",
+                    bodies_.target[index]->objectName().c_str());
+            }
+            break;
+        case PhysicsCommandType::TRANSLATE:
+            bodies_.position[index] += value;
+            break;
+        case PhysicsCommandType::WAKE:
+            break;
     }
-    return result;
 }
 
-PhysicsResult PhysicsController::setVelocity(string objectName, vec3 velocity) {
-    std::unique_lock<std::shared_mutex> scopeLock(physicsObjectQueueLock_);
-    auto result = PhysicsResult::FAILURE;
-    auto poit = physicsObjects_.find(objectName);
-    if (poit != physicsObjects_.end()) {
-        // On velocity change, flush object position and reset time
-        poit->second.get()->fullFlush();
-        poit->second.get()->velocity = velocity;
-        result = PhysicsResult::OK;
-    } else {
-        printf("PhysicsController::setVelocity: %s not found", objectName.c_str());
+PhysicsResult PhysicsController::applyNamedCommand(const string &objectName, PhysicsCommand command) {
+    // Queued behind the handle commands, so named and handle calls on a body land in the order they were made
+    command.handle = getHandle(objectName);
+    if (PHYS_INVALID_HANDLE == command.handle) {
+        printf("PhysicsController::applyNamedCommand: %s not found\n", objectName.c_str());
+        return PhysicsResult::FAILURE;
     }
-    return result;
+    return queueCommand(command);
 }
 
-PhysicsResult PhysicsController::setAcceleration(string objectName, vec3 acceleration) {
-    std::unique_lock<std::shared_mutex> scopeLock(physicsObjectQueueLock_);
-    auto result = PhysicsResult::FAILURE;
-    auto poit = physicsObjects_.find(objectName);
-    if (poit != physicsObjects_.end()) {
-        // On acceleration change, flush object position and reset time
-        poit->second.get()->fullFlush();
-        poit->second.get()->acceleration = acceleration;
-        result = PhysicsResult::OK;
-    } else {
-        printf("PhysicsController::setAcceleration: %s not found", objectName.c_str());
-    }
-    return result;
+PhysicsResult PhysicsController::queueCommand(const PhysicsCommand &command) {
+    // Once a change has spilled, later ones follow it so they are not applied ahead of it
+    if (!commandsSpilled_ && commandQueue_.push(command)) return PhysicsResult::OK;
+    std::unique_lock<std::mutex> scopeLock(spillLock_);
+    spilledCommands_.push_back(command);
+    commandsSpilled_ = true;
+    return PhysicsResult::OK;
 }
 
-PhysicsResult PhysicsController::applyForce(string objectName, vec3 force) {
-    std::unique_lock<std::shared_mutex> scopeLock(physicsObjectQueueLock_);
-    auto result = PhysicsResult::FAILURE;
-    auto poit = physicsObjects_.find(objectName);
-    if (poit != physicsObjects_.end()) {
-        poit->second.get()->fullFlush();
-        // Check if the mass is zero
-        if (0.0 != poit->second.get()->mass) {
-            poit->second.get()->acceleration += (force / vec3(poit->second.get()->mass));
-        } else {
-            fprintf(stderr,
-                "PhysicsController::applyForce: Failed to apply force! Target object %s has no mass set!",
-                poit->second.get()->target->objectName().c_str());
+void PhysicsController::applyQueuedCommands() {
+    // Skips changes to bodies that were removed after the change was queued
+    auto apply = [this](const PhysicsCommand &command) {
+        auto index = bodies_.indexOf(command.handle);
+        if (index == PHYS_INVALID_INDEX) {
+            printf("PhysicsController::applyQueuedCommands: Handle %u does not refer to a body\n", command.handle);
+            return;
         }
-        result = PhysicsResult::OK;
-    } else {
-        printf("PhysicsController::setAcceleration: %s not found", objectName.c_str());
+        applyCommand(index, command);
+    };
+    PhysicsCommand command;
+    while (commandQueue_.pop(&command)) {
+        apply(command);
     }
-    return result;
+    if (!commandsSpilled_) return;
+    std::unique_lock<std::mutex> scopeLock(spillLock_);
+    for (auto &spilled : spilledCommands_) {
+        apply(spilled);
+    }
+    spilledCommands_.clear();
+    commandsSpilled_ = false;
+}
+
+PhysicsResult PhysicsController::setPosition(string objectName, vec3 position) {
+    return applyNamedCommand(objectName, { PhysicsCommandType::SET_POSITION, PHYS_INVALID_HANDLE, position });
+}
+
+PhysicsResult PhysicsController::setVelocity(string objectName, vec3 velocity) {
+    return applyNamedCommand(objectName, { PhysicsCommandType::SET_VELOCITY, PHYS_INVALID_HANDLE, velocity });
+}
+
+PhysicsResult PhysicsController::setAcceleration(string objectName, vec3 acceleration) {
+    return applyNamedCommand(objectName, { PhysicsCommandType::SET_ACCELERATION, PHYS_INVALID_HANDLE, acceleration });
+}
+
+PhysicsResult PhysicsController::applyForce(string objectName, vec3 force) {
+    return applyNamedCommand(objectName, { PhysicsCommandType::APPLY_FORCE, PHYS_INVALID_HANDLE, force });
 }
 
 PhysicsResult PhysicsController::applyInstantForce(string objectName, vec3 force) {
-    std::unique_lock<std::shared_mutex> scopeLock(physicsObjectQueueLock_);
-    auto result = PhysicsResult::FAILURE;
-    auto poit = physicsObjects_.find(objectName);
-    if (poit != physicsObjects_.end()) {
-        poit->second.get()->fullFlush();
-        // Check if the mass is zero
-        if (0.0 != poit->second.get()->mass) {
-            float cappedTime = CAP_TIME(deltaTime);
-            poit->second.get()->velocity += vec3(0.5f) * (force / vec3(poit->second.get()->mass)) * vec3(cappedTime);
-            printf("PhysicsController::applyInstantForce: Capped time %f\n", cappedTime);
-        } else {
-            fprintf(stderr,
-                "PhysicsController::applyForce: Failed to apply force! Target object %s has no mass set!",
-                poit->second.get()->target->objectName().c_str());
+    return applyNamedCommand(objectName, { PhysicsCommandType::APPLY_INSTANT_FORCE, PHYS_INVALID_HANDLE, force });
+}
+
+PhysicsResult PhysicsController::translate(string objectName, vec3 translation) {
+    return applyNamedCommand(objectName, { PhysicsCommandType::TRANSLATE, PHYS_INVALID_HANDLE, translation });
+}
+
+PhysicsResult PhysicsController::wake(string objectName) {
+    return applyNamedCommand(objectName, { PhysicsCommandType::WAKE, PHYS_INVALID_HANDLE, vec3(0.0f) });
+}
+
+PhysicsResult PhysicsController::setPosition(PhysicsHandle handle, vec3 position) {
+    return queueCommand({ PhysicsCommandType::SET_POSITION, handle, position });
+}
+
+PhysicsResult PhysicsController::setVelocity(PhysicsHandle handle, vec3 velocity) {
+    return queueCommand({ PhysicsCommandType::SET_VELOCITY, handle, velocity });
+}
+
+PhysicsResult PhysicsController::setAcceleration(PhysicsHandle handle, vec3 acceleration) {
+    return queueCommand({ PhysicsCommandType::SET_ACCELERATION, handle, acceleration });
+}
+
+PhysicsResult PhysicsController::applyForce(PhysicsHandle handle, vec3 force) {
+    return queueCommand({ PhysicsCommandType::APPLY_FORCE, handle, force });
+}
+
+PhysicsResult PhysicsController::applyInstantForce(PhysicsHandle handle, vec3 force) {
+    return queueCommand({ PhysicsCommandType::APPLY_INSTANT_FORCE, handle, force });
+}
+
+PhysicsResult PhysicsController::translate(PhysicsHandle handle, vec3 translation) {
+    return queueCommand({ PhysicsCommandType::TRANSLATE, handle, translation });
+}
+
+PhysicsResult PhysicsController::wake(PhysicsHandle handle) {
+    return queueCommand({ PhysicsCommandType::WAKE, handle, vec3(0.0f) });
+}
+
+PhysicsResult PhysicsController::subscribe(string name, SUBSCRIPTION_PARAM callback) {
+    std::unique_lock<std::mutex> scopeLock(subscriberLock_);
+    for (auto &subscriber : subscribers_) {
+        if (subscriber.name == name) {
+            subscriber.callback = callback;
+            return PhysicsResult::OK;
         }
-        result = PhysicsResult::OK;
-    } else {
-        printf("PhysicsController::setAcceleration: %s not found", objectName.c_str());
     }
-    return result;
+    subscribers_.emplace_back(name, callback);
+    return PhysicsResult::OK;
 }
 
-PhysicsResult PhysicsController::translate(string objectName, vec3 translation) {
-    std::unique_lock<std::shared_mutex> scopeLock(physicsObjectQueueLock_);
-    auto result = PhysicsResult::FAILURE;
-    auto poit = physicsObjects_.find(objectName);
-    if (poit != physicsObjects_.end()) {
-        poit->second.get()->position += translation;
-        result = PhysicsResult::OK;
-    } else {
-        printf("PhysicsController::translate: %s not found", objectName.c_str());
+PhysicsResult PhysicsController::unsubscribe(string name) {
+    std::unique_lock<std::mutex> scopeLock(subscriberLock_);
+    for (auto it = subscribers_.begin(); it != subscribers_.end(); ++it) {
+        if (it->name == name) {
+            subscribers_.erase(it);
+            return PhysicsResult::OK;
+        }
     }
-    return result;
+    fprintf(stderr, "PhysicsController::unsubscribe: %s is not subscribed\n", name.c_str());
+    return PhysicsResult::FAILURE;
 }
 
 uint PhysicsController::getDefaultThreadSize() {
-    auto poolSize = std::thread::hardware_concurrency();
-    // Check if poolSize is valid
-    if (poolSize == 0) {
-        poolSize = PHYS_MAX_THREADS;
+    return JobSystem::getDefaultThreadSize();
+}
+
+void PhysicsController::publishQueryWorld() {
+    auto world = std::make_shared<PhysicsQueryWorld>(broadphase_.cellSize());
+    {
+        std::shared_lock<std::shared_mutex> scopeLock(physicsObjectQueueLock_);
+        for (uint i = 0; i < bodies_.size(); ++i) {
+            if (!HAS_COLLIDER(i)) continue;
+            // Collider boxes are stored relative to the position by the COLLISION stage, so no matrix math is needed
+            auto position = physicsPosition(i);
+            auto center = position + bodies_.colliderCenter[i];
+            auto offset = glm::abs(bodies_.colliderOffset[i]);
+            world->add(bodies_.handleOf(i), bodies_.target[i], bodies_.collider[i]->getCollider()->layer(),
+                center - offset, center + offset, bodies_.mesh[i], position,
+                bodies_.mesh[i] ? meshScale(i) : vec3(1.0f));
+        }
+    }
+    // Queries already running keep their own reference to the old snapshot
+    std::unique_lock<std::mutex> scopeLock(queryWorldLock_);
+    queryWorld_ = std::move(world);
+}
+
+void PhysicsController::flushCounters(CollisionScratch *scratch) {
+    // Relaxed is enough - the totals are only read once the stage has been waited on
+    pairsTested_.fetch_add(scratch->pairsTested, std::memory_order_relaxed);
+    contactsFound_.fetch_add(scratch->contactsFound, std::memory_order_relaxed);
+    scratch->pairsTested = 0;
+    scratch->contactsFound = 0;
+}
+
+void PhysicsController::publishStats(const JobSystemStats &jobsBefore) {
+    PhysicsStats stats;
+    auto jobsAfter = jobSystem_->getStats();
+    stats.timing = stageTiming_;
+    stats.step = stepCount_;
+    stats.substeps = lastSubsteps_;
+    {
+        std::shared_lock<std::shared_mutex> scopeLock(physicsObjectQueueLock_);
+        stats.bodies = bodies_.size();
+        stats.awakeBodies = bodies_.activeCount();
+    }
+    stats.pairsTested = pairsTested_.load(std::memory_order_relaxed);
+    stats.contactsFound = contactsFound_.load(std::memory_order_relaxed);
+    stats.solverPasses = solverPasses_;
+    stats.jobsRun = jobsAfter.jobsRun - jobsBefore.jobsRun;
+    stats.queueWaitMs = jobsAfter.queueWaitMs - jobsBefore.queueWaitMs;
+    stats.workerIdleMs = jobsAfter.workerIdleMs - jobsBefore.workerIdleMs;
+    std::unique_lock<std::mutex> scopeLock(statsLock_);
+    stats_ = stats;
+}
+
+PhysicsStats PhysicsController::getStats() {
+    std::unique_lock<std::mutex> scopeLock(statsLock_);
+    return stats_;
+}
+
+std::shared_ptr<const PhysicsQueryWorld> PhysicsController::getQueryWorld() {
+    std::unique_lock<std::mutex> scopeLock(queryWorldLock_);
+    return queryWorld_;
+}
+
+bool PhysicsController::raycast(vec3 origin, vec3 direction, float maxDistance, PhysicsQueryHit *hit, uint32_t mask) {
+    auto world = getQueryWorld();
+    return world && world->raycast(origin, direction, maxDistance, mask, hit);
+}
+
+bool PhysicsController::sweepBox(vec3 center, vec3 halfExtents, vec3 direction, float maxDistance,
+    PhysicsQueryHit *hit, uint32_t mask) {
+    auto world = getQueryWorld();
+    return world && world->sweepBox(center, halfExtents, direction, maxDistance, mask, hit);
+}
+
+uint PhysicsController::overlapBox(vec3 center, vec3 halfExtents, vector<PhysicsQueryHit> *hits, uint32_t mask) {
+    auto world = getQueryWorld();
+    if (!world) {
+        hits->clear();
+        return 0;
     }
-    printf("PhysicsController::getDefaultThreadSize: %u\n", poolSize);
-    return poolSize;
+    return world->overlapBox(center, halfExtents, mask, hits);
 }
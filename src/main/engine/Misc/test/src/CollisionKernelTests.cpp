@@ -0,0 +1,226 @@
+/**
+ * @file CollisionKernelTests.cpp
+ * @author Alec Jackson
+ * @brief Unit tests for the batched AABB collision kernel
+ * @version 0.1
+ * @date 2025
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#include <gtest/gtest.h>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include <CollisionKernel.hpp>
+#include <TestObject.hpp>
+
+// Test Fixtures
+class GivenRandomBoxes: public ::testing::Test {
+ protected:
+    void SetUp() override {
+        std::mt19937 rng(1234);
+        std::uniform_real_distribution<float> position(-10.0f, 10.0f);
+        std::uniform_real_distribution<float> extent(0.0f, 3.0f);
+        for (uint i = 0; i < boxCount_; ++i) {
+            auto center = vec3(position(rng), position(rng), position(rng));
+            auto offset = vec3(extent(rng), extent(rng), extent(rng));
+            batch_.push(center - offset, center + offset);
+        }
+        testMin_ = vec3(-2.0f, -1.5f, -3.0f);
+        testMax_ = vec3(2.5f, 1.0f, 0.5f);
+    }
+    // Deliberately not a multiple of any SIMD width, so the scalar tail is exercised
+    uint boxCount_ = 1003;
+    AabbBatch batch_;
+    vec3 testMin_;
+    vec3 testMax_;
+};
+
+class GivenColliderObjects: public ::testing::Test {
+ protected:
+    void SetUp() override {
+        basicModel_ = std::make_shared<Polygon>();
+        vector<float> bmVertices = {
+            {  // Offset 1 and center 0 at scale 1
+                -1.0f, -1.0f, -1.0f,
+                1.0f, 1.0f, 1.0f,
+            }
+        };
+        basicModel_->modelMap["to"] = std::make_shared<Model>(bmVertices.size() / 3, bmVertices);
+        // Grid aligned positions and power of two scales keep every value exact, so both paths see the same numbers
+        float scales[] = { 0.5f, 1.0f, 2.0f };
+        for (int i = 0; i < 27; ++i) {
+            auto object = std::make_unique<TestObject>(basicModel_, "collider-" + std::to_string(i));
+            object->createCollider("test");
+            object->setScale(scales[i % 3]);
+            object->setPosition(vec3((i % 5) * 0.5f, (i % 7) * 0.75f, (i % 3) * 1.5f));
+            object->updateModelMatrices();
+            object->updateCollider();
+            objects_.push_back(std::move(object));
+        }
+    }
+    // Builds the same box the physics controller stores for a body
+    void getBox(TestObject *object, vec3 position, vec3 *center, vec3 *offset) {
+        auto collider = object->getCollider();
+        auto tm = glm::translate(mat4(1.0f), position);
+        auto fullCenter = ColliderObject::createCenter(tm, collider->pScaleMatrix(), collider);
+        *center = vec3(fullCenter);
+        *offset = vec3(ColliderObject::createOffset(tm, collider->pScaleMatrix(), fullCenter, collider));
+    }
+    std::shared_ptr<Polygon> basicModel_;
+    vector<std::unique_ptr<TestObject>> objects_;
+};
+
+/**
+ * @brief Ensures the SIMD kernel produces exactly the same masks as the scalar reference.
+ */
+TEST_F(GivenRandomBoxes, WhenBatchTested_ThenMasksMatchScalarReference) {
+    /* Preparation */
+    vector<uint8_t> expected(boxCount_);
+    vector<uint8_t> actual(boxCount_);
+
+    /* Action */
+    aabbOverlapBatchScalar(testMin_, testMax_, batch_, 0, boxCount_, expected.data());
+    aabbOverlapBatch(testMin_, testMax_, batch_, 0, boxCount_, actual.data());
+
+    /* Validation */
+    for (uint i = 0; i < boxCount_; ++i) {
+        auto boxMin = vec3(batch_.minX[i], batch_.minY[i], batch_.minZ[i]);
+        auto boxMax = vec3(batch_.maxX[i], batch_.maxY[i], batch_.maxZ[i]);
+        ASSERT_EQ(expected[i], actual[i]) << "Box " << i;
+        ASSERT_EQ(aabbOverlap(testMin_, testMax_, boxMin, boxMax), actual[i]) << "Box " << i;
+    }
+}
+
+/**
+ * @brief Ensures a sub range of the batch writes its first result to masks[0] and leaves the rest of the buffer alone.
+ */
+TEST_F(GivenRandomBoxes, WhenSubRangeTested_ThenMasksWrittenFromStartOfBuffer) {
+    /* Preparation */
+    uint begin = 5;
+    uint end = 22;
+    vector<uint8_t> expected(boxCount_);
+    vector<uint8_t> actual(boxCount_, 0xFF);
+    aabbOverlapBatchScalar(testMin_, testMax_, batch_, 0, boxCount_, expected.data());
+
+    /* Action */
+    aabbOverlapBatch(testMin_, testMax_, batch_, begin, end, actual.data());
+
+    /* Validation */
+    for (uint i = begin; i < end; ++i) {
+        ASSERT_EQ(expected[i], actual[i - begin]) << "Box " << i;
+    }
+    for (uint i = end - begin; i < boxCount_; ++i) {
+        ASSERT_EQ(0xFF, actual[i]) << "Index " << i;
+    }
+}
+
+/**
+ * @brief Ensures the kernel reports the same axes as ColliderObject::getCollisionRaw for real colliders.
+ */
+TEST_F(GivenColliderObjects, WhenComparedToGetCollisionRaw_ThenMasksMatch) {
+    /* Preparation */
+    AabbBatch batch;
+    for (auto &object : objects_) {
+        vec3 center, offset;
+        getBox(object.get(), object->getPosition(), &center, &offset);
+        batch.push(center - offset, center + offset);
+    }
+    vector<uint8_t> masks(objects_.size());
+
+    for (uint i = 0; i < objects_.size(); ++i) {
+        /* Action */
+        vec3 center, offset;
+        getBox(objects_[i].get(), objects_[i]->getPosition(), &center, &offset);
+        aabbOverlapBatch(center - offset, center + offset, batch, 0, batch.size(), masks.data());
+
+        /* Validation */
+        for (uint j = 0; j < objects_.size(); ++j) {
+            auto expected = ColliderObject::getCollisionRaw(objects_[i]->getPosition(), objects_[i]->getCollider(),
+                objects_[j]->getPosition(), objects_[j]->getCollider());
+            ASSERT_EQ(expected, masks[j]) << "Pair " << i << ", " << j;
+        }
+    }
+}
+
+/**
+ * @brief Ensures a box swept through a thin box reports the fraction of its motion where it first overlaps by the
+ * skin, and that a box passing beside it reports a miss.
+ */
+TEST(GivenSweptBoxes, WhenBoxSweptThroughThinBox_ThenFirstContactReturned) {
+    /* Preparation */
+    vec3 offset = vec3(1.0f);
+    vec3 wallCenter = vec3(0.0f);
+    vec3 wallOffset = vec3(10.0f, 0.0f, 10.0f);
+    vec3 start = vec3(0.0f, 9.0f, 0.0f);
+    vec3 motion = vec3(0.0f, -20.0f, 0.0f);
+    float skin = 0.5f;
+
+    /* Action */
+    auto hit = aabbSweep(start, offset, motion, wallCenter, wallOffset, skin);
+    auto miss = aabbSweep(start + vec3(12.0f, 0.0f, 0.0f), offset, motion, wallCenter, wallOffset, skin);
+    auto tooThin = aabbSweep(start, vec3(0.25f), motion, wallCenter, wallOffset, skin);
+
+    /* Validation */
+    // The bottom of the box has to travel 8 units to reach the wall and 0.5 more to overlap by the skin
+    ASSERT_FLOAT_EQ(8.5f / 20.0f, hit);
+    ASSERT_GT(miss, 1.0f);
+    ASSERT_GT(tooThin, 1.0f);
+}
+
+/**
+ * @brief Ensures the box-triangle test rejects a box that only overlaps the triangle's bounds, and accepts boxes
+ * crossing the triangle's face or touching its edge.
+ */
+TEST(GivenDiagonalTriangle, WhenBoxesTested_ThenOnlyBoxesTouchingTriangleOverlap) {
+    /* Preparation */
+    // Covers the half of the [0, 4] square on the floor where x + z <= 4
+    vec3 v0 = vec3(0.0f, 0.0f, 0.0f);
+    vec3 v1 = vec3(4.0f, 0.0f, 0.0f);
+    vec3 v2 = vec3(0.0f, 0.0f, 4.0f);
+    vec3 offset = vec3(0.5f);
+
+    /* Action */
+    auto inside = aabbTriangleOverlap(vec3(1.0f, 0.25f, 1.0f), offset, v0, v1, v2);
+    auto boundsOnly = aabbTriangleOverlap(vec3(3.5f, 0.0f, 3.5f), offset, v0, v1, v2);
+    auto touchingEdge = aabbTriangleOverlap(vec3(2.5f, 0.0f, 2.5f), offset, v0, v1, v2);
+    auto above = aabbTriangleOverlap(vec3(1.0f, 0.75f, 1.0f), offset, v0, v1, v2);
+
+    /* Validation */
+    ASSERT_TRUE(inside);
+    ASSERT_FALSE(boundsOnly);
+    ASSERT_TRUE(touchingEdge);
+    ASSERT_FALSE(above);
+}
+
+/**
+ * @brief Ensures aabbEdgePoint matches ColliderObject::getEdgePointRaw, including the case where an object has moved
+ * past the other object's center.
+ */
+TEST_F(GivenColliderObjects, WhenEdgePointCalculated_ThenMatchesGetEdgePointRaw) {
+    vec3 signs[] = { vec3(1.0f, -1.0f, 1.0f), vec3(-1.0f, 1.0f, -1.0f), vec3(0.0f, 1.0f, 0.0f) };
+    for (uint i = 0; i < objects_.size(); ++i) {
+        for (uint j = 0; j < objects_.size(); ++j) {
+            for (auto &epSign : signs) {
+                /* Preparation */
+                auto first = objects_[i].get();
+                auto second = objects_[j].get();
+                vec3 center1, offset1, center2, offset2;
+                getBox(first, first->getPosition(), &center1, &offset1);
+                getBox(second, second->getPosition(), &center2, &offset2);
+
+                /* Action */
+                auto actual = aabbEdgePoint(center1, offset1, center2, offset2, epSign);
+
+                /* Validation */
+                auto expected = ColliderObject::getEdgePointRaw(first->getPosition(), first->getCollider(),
+                    second->getPosition(), second->getCollider(), epSign);
+                ASSERT_FLOAT_EQ(expected.x, actual.x);
+                ASSERT_FLOAT_EQ(expected.y, actual.y);
+                ASSERT_FLOAT_EQ(expected.z, actual.z);
+            }
+        }
+    }
+}
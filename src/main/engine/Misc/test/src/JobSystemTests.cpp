@@ -0,0 +1,208 @@
+/**
+ * @file JobSystemTests.cpp
+ * @author Alec Jackson
+ * @brief Unit tests for the engine job system
+ * @version 0.1
+ * @date 2025
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono> //NOLINT
+#include <memory>
+#include <thread> //NOLINT
+#include <vector>
+#include <JobSystem.hpp>
+
+// Test Fixtures
+class GivenJobSystem: public ::testing::Test {
+ protected:
+    void SetUp() override {
+        jobSystem_ = std::make_unique<JobSystem>(4);
+    }
+    void TearDown() override {
+        jobSystem_.reset();
+    }
+    std::unique_ptr<JobSystem> jobSystem_;
+};
+
+/**
+ * @brief Ensures that worker threads close cleanly when the job system is destroyed with work still queued.
+ */
+TEST(GivenJobSystemWithQueuedWork, WhenDestroyed_ThenQueuedJobsFinishBeforeThreadsClose) {
+    /* Preparation */
+    std::atomic<int> runCount { 0 };
+    auto jobSystem = new JobSystem(2);
+    for (int i = 0; i < 100; ++i) {
+        jobSystem->submit([&runCount]() { runCount++; });
+    }
+
+    /* Action */
+    delete jobSystem;
+
+    /* Validation */
+    ASSERT_EQ(100, runCount.load());
+}
+
+/**
+ * @brief Ensures a submitted job runs and reports completion once waited on.
+ */
+TEST_F(GivenJobSystem, WhenJobSubmittedAndWaitedOn_ThenJobComplete) {
+    /* Preparation */
+    std::atomic<bool> ran { false };
+
+    /* Action */
+    auto job = jobSystem_->submit([&ran]() { ran = true; });
+    jobSystem_->wait(job);
+
+    /* Validation */
+    ASSERT_TRUE(ran.load());
+    ASSERT_TRUE(JobSystem::isComplete(job));
+}
+
+/**
+ * @brief Ensures that a job never starts before the jobs it depends on have completed.
+ */
+TEST_F(GivenJobSystem, WhenJobHasDependencies_ThenDependenciesRunFirst) {
+    /* Preparation */
+    std::atomic<int> finishedDeps { 0 };
+    int depsSeen = -1;
+    vector<JobHandle> deps;
+    for (int i = 0; i < 8; ++i) {
+        deps.push_back(jobSystem_->submit([&finishedDeps]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            finishedDeps++;
+        }));
+    }
+
+    /* Action */
+    auto job = jobSystem_->submit([&finishedDeps, &depsSeen]() { depsSeen = finishedDeps; }, deps);
+    jobSystem_->wait(job);
+
+    /* Validation */
+    ASSERT_EQ(8, depsSeen);
+}
+
+/**
+ * @brief Ensures parallelFor visits every index exactly once, including when count is not a multiple of the batch
+ * size.
+ */
+TEST_F(GivenJobSystem, WhenParallelForRun_ThenEveryIndexVisitedOnce) {
+    /* Preparation */
+    uint count = 1001;
+    vector<std::atomic<int>> visits(count);
+    for (auto &visit : visits) visit = 0;
+
+    /* Action */
+    auto job = jobSystem_->parallelFor(count, 7, [&visits](uint begin, uint end) {
+        for (uint i = begin; i < end; ++i) visits[i]++;
+    });
+    jobSystem_->wait(job);
+
+    /* Validation */
+    for (uint i = 0; i < count; ++i) {
+        ASSERT_EQ(1, visits[i].load()) << "Index " << i;
+    }
+}
+
+/**
+ * @brief Ensures an empty parallelFor completes immediately.
+ */
+TEST_F(GivenJobSystem, WhenParallelForEmpty_ThenJobCompletes) {
+    /* Action */
+    auto job = jobSystem_->parallelFor(0, 0, [](uint, uint) { FAIL(); });
+    jobSystem_->wait(job);
+
+    /* Validation */
+    ASSERT_TRUE(JobSystem::isComplete(job));
+}
+
+/**
+ * @brief Ensures jobs that wait on other jobs do not deadlock the pool, even when every worker is waiting.
+ */
+TEST_F(GivenJobSystem, WhenJobsWaitOnNestedJobs_ThenNoDeadlockOccurs) {
+    /* Preparation */
+    std::atomic<int> innerCount { 0 };
+    auto jobSystem = jobSystem_.get();
+
+    /* Action */
+    auto outer = jobSystem->parallelFor(16, 1, [jobSystem, &innerCount](uint, uint) {
+        auto inner = jobSystem->parallelFor(16, 1, [&innerCount](uint, uint) { innerCount++; });
+        jobSystem->wait(inner);
+    });
+    jobSystem->wait(outer);
+
+    /* Validation */
+    ASSERT_EQ(16 * 16, innerCount.load());
+}
+
+/**
+ * @brief Ensures a job system without workers still runs jobs on the thread that waits on them.
+ */
+TEST(GivenJobSystemWithoutWorkers, WhenJobWaitedOn_ThenJobRunsOnWaitingThread) {
+    /* Preparation */
+    JobSystem jobSystem(0);
+    std::atomic<int> runCount { 0 };
+
+    /* Action */
+    auto job = jobSystem.parallelFor(10, 3, [&runCount](uint begin, uint end) {
+        runCount += static_cast<int>(end - begin);
+    });
+    jobSystem.wait(job);
+
+    /* Validation */
+    ASSERT_EQ(0u, jobSystem.threadCount());
+    ASSERT_EQ(10, runCount.load());
+}
+
+/**
+ * @brief Ensures a waiting thread only helps with the job it waits on and that job's dependencies, so it never runs
+ * unrelated work that might need a lock the waiting thread holds.
+ */
+TEST(GivenJobSystemWithoutWorkers, WhenJobWaitedOn_ThenUnrelatedJobsNotRunByWaitingThread) {
+    /* Preparation */
+    JobSystem jobSystem(0);
+    std::atomic<bool> unrelatedRan { false };
+    std::atomic<int> chainRan { 0 };
+    auto unrelated = jobSystem.submit([&unrelatedRan]() { unrelatedRan = true; });
+    auto dependency = jobSystem.submit([&chainRan]() { chainRan++; });
+    auto job = jobSystem.submit([&chainRan]() { chainRan++; }, { dependency });
+
+    /* Action */
+    jobSystem.wait(job);
+    auto unrelatedRanDuringWait = unrelatedRan.load();
+    jobSystem.wait(unrelated);
+
+    /* Validation */
+    ASSERT_EQ(2, chainRan.load());
+    ASSERT_FALSE(unrelatedRanDuringWait);
+    ASSERT_TRUE(unrelatedRan.load());
+}
+
+/**
+ * @brief Ensures the stats count every job run, and the time workers spend asleep with nothing to do.
+ */
+TEST_F(GivenJobSystem, WhenJobsRunAfterIdling_ThenStatsCountJobsAndIdleTime) {
+    /* Preparation */
+    auto before = jobSystem_->getStats();
+    // Give the workers time to go to sleep
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    /* Action */
+    // Slow ranges, so the waiting thread cannot finish them all before the workers wake up
+    auto job = jobSystem_->parallelFor(100, 10, [](uint, uint) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    });
+    jobSystem_->wait(job);
+    // The workers only add their idle time once they wake up
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+    /* Validation */
+    auto after = jobSystem_->getStats();
+    // Ten ranges plus the job joining them
+    ASSERT_EQ(11u, after.jobsRun - before.jobsRun);
+    ASSERT_GE(after.queueWaitMs, before.queueWaitMs);
+    ASSERT_GT(after.workerIdleMs - before.workerIdleMs, 10.0);
+}
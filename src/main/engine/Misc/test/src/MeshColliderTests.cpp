@@ -0,0 +1,191 @@
+/**
+ * @file MeshColliderTests.cpp
+ * @author Alec Jackson
+ * @brief Unit tests for the triangle mesh collider and its bounding volume hierarchy
+ * @version 0.1
+ * @date 2025
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cfloat>
+#include <memory>
+#include <random>
+#include <vector>
+#include <MeshCollider.hpp>
+
+// True when every component of a is at most the matching component of b
+static bool lessEqual(const vec3 &a, const vec3 &b) {
+    return a.x <= b.x && a.y <= b.y && a.z <= b.z;
+}
+
+// Test Fixtures
+class GivenRandomTriangleMesh: public ::testing::Test {
+ protected:
+    void SetUp() override {
+        std::mt19937 rng(4321);
+        std::uniform_real_distribution<float> position(-50.0f, 50.0f);
+        std::uniform_real_distribution<float> corner(-2.0f, 2.0f);
+        vector<float> vertices;
+        for (uint i = 0; i < triangleCount_; ++i) {
+            auto base = vec3(position(rng), position(rng) * 0.1f, position(rng));
+            for (int k = 0; k < 3; ++k) {
+                auto v = base + vec3(corner(rng), corner(rng), corner(rng));
+                vertices.insert(vertices.end(), { v.x, v.y, v.z });
+            }
+        }
+        mesh_ = std::make_unique<MeshCollider>(vertices);
+    }
+    // Reference raycast that tests every triangle
+    bool bruteRaycast(const vec3 &origin, const vec3 &motion, float *fraction, uint *triangle) {
+        bool hit = false;
+        for (uint tri = 0; tri < mesh_->triangleCount(); ++tri) {
+            auto &a = mesh_->vertex(tri, 0);
+            auto edge1 = mesh_->vertex(tri, 1) - a;
+            auto edge2 = mesh_->vertex(tri, 2) - a;
+            auto p = glm::cross(motion, edge2);
+            auto det = glm::dot(edge1, p);
+            if (det == 0.0f) continue;
+            // Same arithmetic as MeshCollider::raycast, so both sides round identically
+            auto invDet = 1.0f / det;
+            auto s = origin - a;
+            auto u = glm::dot(s, p) * invDet;
+            auto q = glm::cross(s, edge1);
+            auto v = glm::dot(motion, q) * invDet;
+            auto t = glm::dot(edge2, q) * invDet;
+            if (u < 0.0f || v < 0.0f || u + v > 1.0f || t < 0.0f || t > *fraction) continue;
+            *fraction = t;
+            *triangle = tri;
+            hit = true;
+        }
+        return hit;
+    }
+    uint triangleCount_ = 2000;
+    std::unique_ptr<MeshCollider> mesh_;
+};
+
+/**
+ * @brief Ensures every triangle lands in exactly one leaf, and every node's bounds contain everything below it.
+ */
+TEST_F(GivenRandomTriangleMesh, WhenBuilt_ThenEveryTriangleInOneLeafInsideParentBounds) {
+    /* Preparation */
+    auto &nodes = mesh_->nodes();
+    vector<uint> leafHits(mesh_->triangleCount(), 0);
+
+    /* Action */
+    for (uint i = 0; i < nodes.size(); ++i) {
+        auto &node = nodes[i];
+        if (node.count == 0) {
+            /* Validation */
+            ASSERT_LT(node.first, nodes.size());
+            for (auto child : { i + 1, node.first }) {
+                ASSERT_TRUE(lessEqual(node.minBound, nodes[child].minBound)) << "Node " << i;
+                ASSERT_TRUE(lessEqual(nodes[child].maxBound, node.maxBound)) << "Node " << i;
+            }
+            continue;
+        }
+        ASSERT_LE(node.count, static_cast<uint>(MESH_BVH_MAX_LEAF_SIZE));
+        for (uint tri = node.first; tri < node.first + node.count; ++tri) {
+            leafHits[tri]++;
+            for (uint corner = 0; corner < 3; ++corner) {
+                auto &v = mesh_->vertex(tri, corner);
+                ASSERT_TRUE(lessEqual(node.minBound, v)) << "Triangle " << tri;
+                ASSERT_TRUE(lessEqual(v, node.maxBound)) << "Triangle " << tri;
+            }
+        }
+    }
+
+    /* Validation */
+    for (uint tri = 0; tri < leafHits.size(); ++tri) {
+        ASSERT_EQ(1u, leafHits[tri]) << "Triangle " << tri;
+    }
+}
+
+/**
+ * @brief Ensures a box query returns exactly the triangles whose bounds overlap the box.
+ */
+TEST_F(GivenRandomTriangleMesh, WhenQueried_ThenMatchesEveryTriangleTest) {
+    std::mt19937 rng(77);
+    std::uniform_real_distribution<float> position(-50.0f, 50.0f);
+    std::uniform_real_distribution<float> extent(0.0f, 6.0f);
+    vector<uint> actual;
+    for (int i = 0; i < 200; ++i) {
+        /* Preparation */
+        auto center = vec3(position(rng), position(rng) * 0.1f, position(rng));
+        auto offset = vec3(extent(rng), extent(rng), extent(rng));
+        vector<uint> expected;
+        for (uint tri = 0; tri < mesh_->triangleCount(); ++tri) {
+            auto &a = mesh_->vertex(tri, 0);
+            auto &b = mesh_->vertex(tri, 1);
+            auto &c = mesh_->vertex(tri, 2);
+            auto triMin = glm::min(a, glm::min(b, c));
+            auto triMax = glm::max(a, glm::max(b, c));
+            if (lessEqual(center - offset, triMax) && lessEqual(triMin, center + offset)) expected.push_back(tri);
+        }
+
+        /* Action */
+        mesh_->query(center - offset, center + offset, &actual);
+
+        /* Validation */
+        std::sort(actual.begin(), actual.end());
+        ASSERT_EQ(expected, actual) << "Query " << i;
+    }
+}
+
+/**
+ * @brief Ensures a raycast through the hierarchy finds the same first hit as testing every triangle.
+ */
+TEST_F(GivenRandomTriangleMesh, WhenRaycast_ThenMatchesEveryTriangleTest) {
+    std::mt19937 rng(78);
+    std::uniform_real_distribution<float> position(-60.0f, 60.0f);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+    uint hits = 0;
+    for (int i = 0; i < 500; ++i) {
+        /* Preparation */
+        auto origin = vec3(position(rng), position(rng) * 0.2f, position(rng));
+        auto motion = vec3(unit(rng), unit(rng) * 0.2f, unit(rng)) * 100.0f;
+        float expectedFraction = 1.0f;
+        float actualFraction = 1.0f;
+        uint expectedTriangle = 0;
+        uint actualTriangle = 0;
+
+        /* Action */
+        auto expected = bruteRaycast(origin, motion, &expectedFraction, &expectedTriangle);
+        auto actual = mesh_->raycast(origin, motion, &actualFraction, &actualTriangle);
+
+        /* Validation */
+        ASSERT_EQ(expected, actual) << "Ray " << i;
+        if (!expected) continue;
+        hits++;
+        ASSERT_NEAR(expectedFraction, actualFraction, 1e-6f) << "Ray " << i;
+    }
+    // Make sure the rays actually exercised the hit path
+    ASSERT_GT(hits, 50u);
+}
+
+/**
+ * @brief Ensures fromPolygon merges every model of a polygon into a single mesh.
+ */
+TEST(GivenPolygonWithTwoModels, WhenMeshBuilt_ThenTrianglesFromBothModelsIncluded) {
+    /* Preparation */
+    Polygon polygon;
+    vector<float> first = { 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f };
+    vector<float> second = {
+        5.0f, 0.0f, 5.0f, 6.0f, 0.0f, 5.0f, 5.0f, 0.0f, 6.0f,
+        5.0f, 1.0f, 5.0f, 6.0f, 1.0f, 5.0f, 5.0f, 1.0f, 6.0f
+    };
+    polygon.modelMap["first"] = std::make_shared<Model>(first.size() / 3, first);
+    polygon.modelMap["second"] = std::make_shared<Model>(second.size() / 3, second);
+
+    /* Action */
+    auto mesh = MeshCollider::fromPolygon(polygon);
+
+    /* Validation */
+    ASSERT_EQ(3u, mesh->triangleCount());
+    ASSERT_FALSE(mesh->nodes().empty());
+    ASSERT_FLOAT_EQ(0.0f, mesh->nodes()[0].minBound.x);
+    ASSERT_FLOAT_EQ(6.0f, mesh->nodes()[0].maxBound.x);
+    ASSERT_FLOAT_EQ(1.0f, mesh->nodes()[0].maxBound.y);
+}
@@ -12,8 +12,10 @@
 #include <gtest/gtest.h>
 #include <iostream>
 #include <memory>
+#include <random>
 #include <string>
 #include <cstdio>
+#include <thread> //NOLINT
 #include <vector>
 #include <ColliderObject.hpp>
 #include <ModelImport.hpp>
@@ -85,15 +87,18 @@ TEST_F(GivenPhysicsControllerGeneral, WhenSceneObjectAdded_ThenObjectPresentInsi
     physicsController_->addSceneObject(&testObject, params);
 
     /* Validation */
+    auto physObj = physicsController_->getPhysicsObject(testObjectName);
     auto objectMap = physicsController_->getPhysicsObjects();
     auto oit = objectMap.find(testObjectName);
     ASSERT_EQ(expectedObjects, objectMap.size());
+    ASSERT_EQ(expectedObjects, physicsController_->getBodies().size());
     ASSERT_NE(objectMap.end(), oit);  // Verify testObjectName exists
-    ASSERT_EQ(testObjectName, oit->second.get()->target->objectName());
-    ASSERT_EQ(isKinematic, oit->second.get()->isKinematic);
-    ASSERT_EQ(obeyGravity, oit->second.get()->obeyGravity);
-    ASSERT_FLOAT_EQ(elasticity, oit->second.get()->elasticity);
-    ASSERT_FLOAT_EQ(mass, oit->second.get()->mass);
+    ASSERT_EQ(oit->second, physObj->handle());
+    ASSERT_EQ(testObjectName, physObj->target()->objectName());
+    ASSERT_EQ(isKinematic, physObj->isKinematic());
+    ASSERT_EQ(obeyGravity, physObj->obeyGravity());
+    ASSERT_FLOAT_EQ(elasticity, physObj->elasticity());
+    ASSERT_FLOAT_EQ(mass, physObj->mass());
 }
 
 /**
@@ -117,6 +122,7 @@ TEST_F(GivenPhysicsControllerGeneral, WhenSceneObjectAddedThenRemoved_ThenSceneO
     /* Validation */
     auto objectList = physicsController_->getPhysicsObjects();
     ASSERT_TRUE(objectList.empty());
+    ASSERT_TRUE(physicsController_->getBodies().empty());
 }
 
 /**
@@ -143,7 +149,7 @@ TEST_F(GivenPhysicsControllerGeneral, WhenUnknownSceneObjectRemoved_ThenOtherObj
     auto objectList = physicsController_->getPhysicsObjects();
     auto oit = objectList.find(testObjectName);
     ASSERT_EQ(expectedObjects, objectList.size());
-    ASSERT_EQ(testObjectName, oit->second.get()->target->objectName());
+    ASSERT_EQ(testObjectName, physicsController_->getPhysicsObject(oit->first)->target()->objectName());
 }
 
 /**
@@ -166,7 +172,7 @@ TEST_F(GivenPhysicsControllerGeneral, WhenSceneObjectAdded_ThenGetPhysicsObjectR
 
     /* Validation */
     ASSERT_GT(physObj.use_count(), 0);  // use_count is used to determine if pointer is active
-    ASSERT_EQ(testObjectName, physObj.get()->target->objectName());
+    ASSERT_EQ(testObjectName, physObj->target()->objectName());
 }
 
 /**
@@ -182,6 +188,145 @@ TEST_F(GivenPhysicsControllerGeneral, WhenNoPhysObjectsPresent_ThenInvalidPointe
     ASSERT_EQ(physObj.use_count(), 0);  // use_count is used to determine if pointer is active
 }
 
+/**
+ * @brief Ensures removing a body from the middle of the body store keeps every other handle pointing at its own
+ * object, and that the removed handle is not reused for a new body.
+ */
+TEST_F(GivenPhysicsControllerGeneral, WhenMiddleObjectRemoved_ThenOtherHandlesStillValid) {
+    /* Preparation */
+    vector<std::unique_ptr<TestObject>> objects;
+    PhysicsParams params = {
+        .isKinematic = false,
+        .obeyGravity = false,
+        .elasticity = 0.0f,
+        .mass = testMassKg
+    };
+    for (int i = 0; i < 5; ++i) {
+        objects.push_back(std::make_unique<TestObject>(TEST_OBJ_PRE("-") + to_string(i)));
+        physicsController_->addSceneObject(objects.back().get(), params);
+    }
+    auto removedHandle = physicsController_->getHandle(objects[1]->objectName());
+
+    /* Action */
+    physicsController_->removeSceneObject(objects[1]->objectName());
+    auto replacement = TestObject(TEST_OBJ_PRE("-replacement"));
+    physicsController_->addSceneObject(&replacement, params);
+    // Adds and removes land at the start of the update
+    physicsController_->update();
+
+    /* Validation */
+    auto &bodies = physicsController_->getBodies();
+    ASSERT_EQ(5u, bodies.size());
+    ASSERT_EQ(PHYS_INVALID_INDEX, bodies.indexOf(removedHandle));
+    ASSERT_NE(removedHandle, physicsController_->getHandle(replacement.objectName()));
+    for (int i = 0; i < 5; ++i) {
+        if (i == 1) continue;
+        auto handle = physicsController_->getHandle(objects[i]->objectName());
+        ASSERT_NE(PHYS_INVALID_INDEX, bodies.indexOf(handle));
+        ASSERT_EQ(objects[i].get(), bodies.target[bodies.indexOf(handle)]);
+    }
+}
+
+/**
+ * @brief Ensures that splitting the stages into batches still updates every object, including when the object
+ * count does not divide evenly between the worker threads.
+ */
+TEST_F(GivenPhysicsControllerGeneral, WhenMoreObjectsThanThreads_ThenEveryObjectUpdated) {
+    /* Preparation */
+    deltaTime = 1.0f;
+    int objectCount = 101;
+    vec3 velocity = vec3(1.0f, 2.0f, 3.0f);
+    vector<std::unique_ptr<TestObject>> objects;
+    PhysicsParams params = {
+        .isKinematic = false,
+        .obeyGravity = false,
+        .elasticity = 0.0f,
+        .mass = testMassKg
+    };
+    for (int i = 0; i < objectCount; ++i) {
+        auto name = TEST_OBJ_PRE("-") + to_string(i);
+        objects.push_back(std::make_unique<TestObject>(name));
+        objects.back()->setPosition(vec3(0));
+        physicsController_->addSceneObject(objects.back().get(), params);
+        physicsController_->setVelocity(name, velocity);
+    }
+
+    /* Action */
+    physicsController_->update();
+
+    /* Validation */
+    for (auto &object : objects) {
+        ASSERT_VEC_EQ(velocity, object->getPosition());
+    }
+}
+
+/**
+ * @brief Ensures a physics controller built on a shared job system runs its stages on that job system, even while
+ * other work is queued on it.
+ */
+TEST(GivenPhysicsControllerWithSharedJobSystem, WhenUpdated_ThenObjectsUpdatedAlongsideOtherJobs) {
+    /* Preparation */
+    deltaTime = 1.0f;
+    JobSystem jobSystem(3);
+    auto physicsController = std::make_unique<PhysicsController>(&jobSystem);
+    vec3 velocity = vec3(1.0f, 2.0f, 3.0f);
+    vector<std::unique_ptr<TestObject>> objects;
+    PhysicsParams params = {
+        .isKinematic = false,
+        .obeyGravity = false,
+        .elasticity = 0.0f,
+        .mass = testMassKg
+    };
+    for (int i = 0; i < 20; ++i) {
+        auto name = TEST_OBJ_PRE("-") + to_string(i);
+        objects.push_back(std::make_unique<TestObject>(name));
+        objects.back()->setPosition(vec3(0));
+        physicsController->addSceneObject(objects.back().get(), params);
+        physicsController->setVelocity(name, velocity);
+    }
+    std::atomic<int> otherCount { 0 };
+    auto otherJob = jobSystem.parallelFor(64, 1, [&otherCount](uint, uint) { otherCount++; });
+
+    /* Action */
+    physicsController->update();
+    jobSystem.wait(otherJob);
+
+    /* Validation */
+    for (auto &object : objects) {
+        ASSERT_VEC_EQ(velocity, object->getPosition());
+    }
+    ASSERT_EQ(64, otherCount.load());
+    ASSERT_TRUE(physicsController->isPipelineComplete());
+}
+
+/**
+ * @brief Ensures the time spent in each pipeline stage is recorded by update.
+ */
+TEST_F(GivenPhysicsControllerGeneral, WhenUpdated_ThenStageTimingRecorded) {
+    /* Preparation */
+    auto testObject = TestObject(testObjectName);
+    PhysicsParams params = {
+        false,
+        false,
+        0.0f,
+        testMassKg
+    };
+    physicsController_->addSceneObject(&testObject, params);
+    auto initialTiming = physicsController_->getStageTiming();
+
+    /* Action */
+    physicsController_->update();
+
+    /* Validation */
+    auto timing = physicsController_->getStageTiming();
+    ASSERT_DOUBLE_EQ(0.0, initialTiming.positionMs);
+    ASSERT_DOUBLE_EQ(0.0, initialTiming.collisionMs);
+    ASSERT_DOUBLE_EQ(0.0, initialTiming.finalizeMs);
+    EXPECT_GT(timing.positionMs, 0.0);
+    EXPECT_GT(timing.collisionMs, 0.0);
+    EXPECT_GT(timing.finalizeMs, 0.0);
+}
+
 /* PHYSICS POSITION PIPELINE TESTS */
 
 class GivenPhysicsControllerPositionPipeline: public ::testing::Test {
@@ -214,7 +359,8 @@ TEST_F(GivenPhysicsControllerPositionPipeline, WhenPositionUpdateCalled_ThenPosi
     vec3 expectedPosition = vec3(5.0f, 4.0f, 3.0f);
     testObject_->setPosition(startingPosition);
     physicsController_->setPosition(testObjectName, expectedPosition);
-    ASSERT_VEC_EQ(expectedPosition, testObject_->getPosition());
+    // Queued until the next update
+    ASSERT_VEC_EQ(startingPosition, testObject_->getPosition());
 
     /* Action */
     physicsController_->update();
@@ -350,19 +496,18 @@ TEST_F(GivenPhysicsControllerPositionPipeline, WhenUpdateCalledAfterVelocityChan
     ASSERT_VEC_EQ(expectedPosition_1, testObject_->getPosition());
 
     // The physics object itself should still hold the original reference pos
-    ASSERT_VEC_EQ(startingPosition, physicsObject->position);
+    ASSERT_VEC_EQ(startingPosition, physicsObject->position());
 
     // We're going to reset the velocity, which will reset the running time counter...
     physicsController_->setVelocity(testObjectName, velocity);
 
-    // ... and also set the current position as the new reference position
-    ASSERT_VEC_EQ(expectedPosition_1, physicsObject->position);
-
     /* Action */
     // Run update again - should calculate with t = 1 second now...
     physicsController_->update();
 
     /* Validation */
+    // ... and also set the current position as the new reference position
+    ASSERT_VEC_EQ(expectedPosition_1, physicsObject->position());
     // Position is 6.5f now because t = 1 second instead of 3.
     ASSERT_VEC_EQ(expectedPosition_2, testObject_->getPosition());
     // Without the time reset & position flush, the last update call would set the
@@ -397,19 +542,18 @@ TEST_F(GivenPhysicsControllerPositionPipeline, WhenUpdateCalledAfterAcceleration
     ASSERT_VEC_EQ(expectedPosition_1, testObject_->getPosition());
 
     // The physics object itself should still hold the original reference pos
-    ASSERT_VEC_EQ(startingPosition, physicsObject->position);
+    ASSERT_VEC_EQ(startingPosition, physicsObject->position());
 
     // We're going to reset the acceleration, which will reset the running time counter...
     physicsController_->setAcceleration(testObjectName, acceleration);
 
-    // ... and also set the current position as the new reference position
-    ASSERT_VEC_EQ(expectedPosition_1, physicsObject->position);
-
     /* Action */
     // Run update again - should calculate with t = 1 second now...
     physicsController_->update();
 
     /* Validation */
+    // ... and also set the current position as the new reference position
+    ASSERT_VEC_EQ(expectedPosition_1, physicsObject->position());
     /*
     Setting the acceleration above does some interesting stuff. We "flush" the position
     and velocity values using acceleration/velocity to bake the old runningTime variable
@@ -504,6 +648,23 @@ TEST_F(GivenPhysicsControllerPositionPipeline, WhenUpdateAfterApplyInstantForce_
     ASSERT_VEC_EQ(expectedPosition, testObject_->getPosition());
 }
 
+/**
+ * @brief Ensures a velocity set by name after an instant force is applied after it, so the body stays put.
+ */
+TEST_F(GivenPhysicsControllerPositionPipeline, WhenVelocityResetAfterApplyInstantForce_ThenBodyDoesNotMove) {
+    /* Preparation */
+    deltaTime = 1.0f;
+    testObject_->setPosition(vec3(0.0f));
+    physicsController_->applyInstantForce(testObjectName, vec3(100.0f, 0.0f, 0.0f));
+    physicsController_->setVelocity(testObjectName, vec3(0.0f));
+
+    /* Action */
+    physicsController_->update();
+
+    /* Validation */
+    ASSERT_VEC_EQ(vec3(0.0f), testObject_->getPosition());
+}
+
 /**
  * @brief Validates applyInstantForce time capping.
  */
@@ -525,6 +686,115 @@ TEST_F(GivenPhysicsControllerPositionPipeline, WhenUpdateAfterApplyInstantForceT
     ASSERT_VEC_EQ(expectedPosition, testObject_->getPosition());
 }
 
+/**
+ * @brief Ensures fixed rate mode runs as many whole steps as fit in the frame and leaves the target interpolated
+ * between its last two steps by the leftover time.
+ */
+TEST_F(GivenPhysicsControllerPositionPipeline, WhenFixedRateUpdate_ThenSubstepsRunAndPositionInterpolated) {
+    /* Preparation */
+    physicsController_->setFixedRate(8);
+    physicsController_->setVelocity(testObjectName, vec3(1.0f, 0.0f, 0.0f));
+    // Two and a half steps of 0.125s
+    deltaTime = 0.3125f;
+    // Steps land on 0.125 and 0.25, rendered halfway between them
+    vec3 expectedPosition = vec3(0.1875f, 0.0f, 0.0f);
+
+    /* Action */
+    physicsController_->update();
+
+    /* Validation */
+    ASSERT_EQ(2u, physicsController_->getLastSubsteps());
+    ASSERT_FLOAT_EQ(0.5f, physicsController_->getInterpolationAlpha());
+    ASSERT_VEC_EQ(expectedPosition, testObject_->getPosition());
+}
+
+/**
+ * @brief Ensures a frame shorter than a fixed step runs no steps, but still advances the interpolated position.
+ */
+TEST_F(GivenPhysicsControllerPositionPipeline, WhenFrameShorterThanFixedStep_ThenOnlyInterpolationAdvances) {
+    /* Preparation */
+    physicsController_->setFixedRate(8);
+    physicsController_->setVelocity(testObjectName, vec3(1.0f, 0.0f, 0.0f));
+    deltaTime = 0.125f;
+    physicsController_->update();
+    ASSERT_EQ(1u, physicsController_->getLastSubsteps());
+    ASSERT_VEC_EQ(vec3(0.0f), testObject_->getPosition());
+    deltaTime = 0.0625f;
+    vec3 expectedPosition = vec3(0.0625f, 0.0f, 0.0f);
+
+    /* Action */
+    physicsController_->update();
+
+    /* Validation */
+    ASSERT_EQ(0u, physicsController_->getLastSubsteps());
+    ASSERT_VEC_EQ(expectedPosition, testObject_->getPosition());
+}
+
+/**
+ * @brief Ensures a frame longer than the substep cap only runs the capped number of steps and drops the rest of the
+ * frame time instead of carrying it into the next update.
+ */
+TEST_F(GivenPhysicsControllerPositionPipeline, WhenFrameExceedsMaxSubsteps_ThenBacklogDropped) {
+    /* Preparation */
+    physicsController_->setFixedRate(8, 2);
+    physicsController_->setVelocity(testObjectName, vec3(1.0f, 0.0f, 0.0f));
+    deltaTime = 1.0f;
+
+    /* Action */
+    physicsController_->update();
+    auto firstSubsteps = physicsController_->getLastSubsteps();
+    deltaTime = 0.125f;
+    physicsController_->update();
+
+    /* Validation */
+    ASSERT_EQ(2u, firstSubsteps);
+    ASSERT_EQ(1u, physicsController_->getLastSubsteps());
+    // Three steps run in total, rendered at the second one
+    ASSERT_VEC_EQ(vec3(0.25f, 0.0f, 0.0f), testObject_->getPosition());
+}
+
+/**
+ * @brief Ensures changing a body's velocity while its target sits at an interpolated position flushes the simulated
+ * position, not the interpolated one.
+ */
+TEST_F(GivenPhysicsControllerPositionPipeline, WhenVelocityChangedBetweenFixedUpdates_ThenSimulatedPositionKept) {
+    /* Preparation */
+    physicsController_->setFixedRate(8);
+    physicsController_->setVelocity(testObjectName, vec3(1.0f, 0.0f, 0.0f));
+    deltaTime = 0.3125f;
+    physicsController_->update();
+    ASSERT_VEC_EQ(vec3(0.1875f, 0.0f, 0.0f), testObject_->getPosition());
+    physicsController_->setVelocity(testObjectName, vec3(0.0f));
+    deltaTime = 0.125f;
+
+    /* Action */
+    physicsController_->update();
+
+    /* Validation */
+    ASSERT_VEC_EQ(vec3(0.25f, 0.0f, 0.0f), testObject_->getPosition());
+}
+
+/**
+ * @brief Ensures setting a position between fixed rate updates moves the body there instead of interpolating from its
+ * old position.
+ */
+TEST_F(GivenPhysicsControllerPositionPipeline, WhenPositionSetBetweenFixedUpdates_ThenBodyStartsFromNewPosition) {
+    /* Preparation */
+    physicsController_->setFixedRate(8);
+    physicsController_->setVelocity(testObjectName, vec3(1.0f, 0.0f, 0.0f));
+    deltaTime = 0.3125f;
+    physicsController_->update();
+    physicsController_->setPosition(testObjectName, vec3(3.0f, 0.0f, 0.0f));
+    deltaTime = 0.25f;
+
+    /* Action */
+    physicsController_->update();
+
+    /* Validation */
+    // Leftover 0.0625s plus 0.25s runs two steps from 3.0, rendered halfway between 3.125 and 3.25
+    ASSERT_VEC_EQ(vec3(3.1875f, 0.0f, 0.0f), testObject_->getPosition());
+}
+
 class GivenTwoKinematicObjects: public GivenPhysicsControllerPositionPipeline {
  protected:
     void SetUp() override {
@@ -589,8 +859,8 @@ TEST_F(GivenTwoKinematicObjects, WhenObjectsCollide_ThenVelocitiesUpdatedAsExpec
     /* Validation */
     // The second object should be moving, and the first should be stationary
     auto po = physicsController_->getPhysicsObject(testObjectName);
-    vec3 actualV1f = physicsController_->getPhysicsObject(testObjectName)->velocity;
-    vec3 actualV2f = physicsController_->getPhysicsObject(otherObjectName)->velocity;
+    vec3 actualV1f = physicsController_->getPhysicsObject(testObjectName)->velocity();
+    vec3 actualV2f = physicsController_->getPhysicsObject(otherObjectName)->velocity();
     EXPECT_VEC_EQ(expectedV1f, actualV1f);
     EXPECT_VEC_EQ(expectedV2f, actualV2f);
 }
@@ -622,8 +892,8 @@ TEST_F(GivenTwoKinematicObjects, WhenObjectsCollide_ThenObjectsMovedToEdgePoint)
 
     /* Validation */
     // The second object should be moving, and the first should have a different velocity
-    vec3 actualFFP = physicsController_->getPhysicsObject(testObjectName)->position;
-    vec3 actualSFP = physicsController_->getPhysicsObject(otherObjectName)->position;
+    vec3 actualFFP = physicsController_->getPhysicsObject(testObjectName)->position();
+    vec3 actualSFP = physicsController_->getPhysicsObject(otherObjectName)->position();
     EXPECT_VEC_EQ(expectedFirstFinalPos, actualFFP);
     EXPECT_VEC_EQ(expectedSecondFinalPos, actualSFP);
 
@@ -632,126 +902,392 @@ TEST_F(GivenTwoKinematicObjects, WhenObjectsCollide_ThenObjectsMovedToEdgePoint)
     ASSERT_NE(ALL_MATCH, isColl);
 }
 
-class GivenKinematicAndNonKinematicObject: public GivenPhysicsControllerPositionPipeline {
- protected:
-    void SetUp() override {
-        physicsController_ = std::make_unique<PhysicsController>(6);
-        // Create the polygons for the test objects
-        basicModel_ = std::make_shared<Polygon>();
-
-        vector<float> bmVertices = {
-            // Dummy vertex points here - just want offset to be 1 and center 0
-            -1.0f, -1.0f, -1.0f,  // vertex 1
-            1.0f, 1.0f, 1.0f  // vertex 2
-        };
-        // This represents a flat X-Z plane that would be used as a map.
-        vector<float> mapVertices = {
-            -1.0f, 0.0f, -1.0f,
-            1.0f, 0.0f, 1.0f
-        };
-        basicModel_->modelMap["to"] = std::make_shared<Model>(bmVertices.size() / 3, bmVertices);
-        mapModel_ = std::make_shared<Polygon>();
-        mapModel_->modelMap["mo"] = std::make_shared<Model>(mapVertices.size() / 3, mapVertices);
+/**
+ * @brief Ensures getStats reports the pair tests and contacts of the last update, with both kinematic bodies counting
+ * the contact from their own side.
+ */
+TEST_F(GivenTwoKinematicObjects, WhenObjectsCollide_ThenStatsCountPairsAndContacts) {
+    /* Preparation */
+    deltaTime = 1.0f;
+    physicsController_->setPosition(testObjectName, vec3(0.0f));
+    physicsController_->setPosition(otherObjectName, vec3(basicModelOffset_ * 2 + 0.5f, 0.0f, 0.0f));
+    physicsController_->setVelocity(testObjectName, vec3(1.0f, 0.0f, 0.0f));
+    auto initialStats = physicsController_->getStats();
 
-        mapObject_ = std::make_unique<TestObject>(mapModel_, mapObjectName);
-        mapObject_->setScale(10.0f);  // Make the map decently large
-        testObject_ = std::make_unique<TestObject>(basicModel_, testObjectName);
-        testObject_->createCollider("test");
-        mapObject_->createCollider("map");
+    /* Action */
+    physicsController_->update();
 
-        // Use the same generic params for each object
-        PhysicsParams kinPar = {
-            .isKinematic = true,
-            .obeyGravity = false,
-            .elasticity = 0.0f,
-            .mass = testMassKg
-        };
-        PhysicsParams nonKinPar = {
-            .isKinematic = false,
-            .obeyGravity = false,
-            .elasticity = 0.0f,
-            .mass = testMassKg
-        };
-        physicsController_->addSceneObject(testObject_.get(), kinPar);
-        physicsController_->addSceneObject(mapObject_.get(), nonKinPar);
-    }
-    std::unique_ptr<TestObject> mapObject_;
-    std::shared_ptr<Polygon> basicModel_;
-    std::shared_ptr<Polygon> mapModel_;
-    inline static float basicModelOffset_ = 1.0f;
-};
+    /* Validation */
+    auto stats = physicsController_->getStats();
+    ASSERT_EQ(0u, initialStats.step);
+    ASSERT_EQ(0u, initialStats.pairsTested);
+    ASSERT_EQ(1u, stats.step);
+    ASSERT_EQ(1u, stats.substeps);
+    ASSERT_EQ(2u, stats.bodies);
+    ASSERT_EQ(2u, stats.awakeBodies);
+    ASSERT_EQ(2u, stats.pairsTested);
+    ASSERT_EQ(2u, stats.contactsFound);
+    ASSERT_GT(stats.jobsRun, 0u);
+    ASSERT_GE(stats.queueWaitMs, 0.0);
+    ASSERT_GT(stats.timing.collisionMs, 0.0);
+}
 
-TEST_F(GivenKinematicAndNonKinematicObject, WhenKinematicCollidesNoPassthrough_ThenObjectClipsToExpectedLocation) {
+/**
+ * @brief Ensures colliding bodies cache their contact, and the entry is evicted once the broadphase stops returning
+ * the pair.
+ */
+TEST_F(GivenTwoKinematicObjects, WhenBodiesSeparated_ThenCachedContactEvicted) {
     /* Preparation */
     deltaTime = 1.0f;
-    vec3 playerVel = vec3(0.0, -1.5f, 0.0f);
-    vec3 playerPos = vec3(0.0f, 2.0f, 0.0f);
-    vec3 mapPos = vec3(0.0f, 0.0f, 0.0f);
-    // Because of flushing, set velocity first
-    physicsController_->setVelocity(testObjectName, playerVel);
-    physicsController_->setPosition(testObjectName, playerPos);
-    physicsController_->setPosition(mapObjectName, mapPos);
-
-
-    // Expected final positions
-    vec3 expectedPlayerFinalPos = vec3(0.0f, 1.0f, 0.0f);
-    vec3 expectedMapFinalPos = vec3(0.0f, 0.0f, 0.0f);
+    physicsController_->setPosition(testObjectName, vec3(0.0f));
+    physicsController_->setPosition(otherObjectName, vec3(basicModelOffset_ * 2 + 0.5f, 0.0f, 0.0f));
+    physicsController_->setVelocity(testObjectName, vec3(1.0f, 0.0f, 0.0f));
+    auto &bodies = physicsController_->getBodies();
+    physicsController_->update();
+    auto testIndex = bodies.indexOf(physicsController_->getHandle(testObjectName));
+    auto cachedCount = bodies.contactCache[testIndex].size();
+    auto cached = cachedCount > 0 ? bodies.contactCache[testIndex][0] : PhysicsContactCache();
 
     /* Action */
+    physicsController_->setVelocity(testObjectName, vec3(0.0f));
+    physicsController_->setPosition(testObjectName, vec3(-100.0f, 0.0f, 0.0f));
     physicsController_->update();
 
     /* Validation */
-    // The second object should be moving, and the first should have a different velocity
-    vec3 actualPlayerFinalPos = testObject_->getPosition();
-    vec3 actualMapFinalPos = mapObject_->getPosition();
-    EXPECT_VEC_EQ(expectedPlayerFinalPos, actualPlayerFinalPos);
-    EXPECT_VEC_EQ(expectedMapFinalPos, actualMapFinalPos);
-
-    // Ensure that the objects are NO LONGER colliding after clipping to the edge point
-    auto isColl = testObject_->getCollider()->getCollision(mapObject_->getCollider());
-    ASSERT_NE(ALL_MATCH, isColl);
+    ASSERT_EQ(1u, cachedCount);
+    ASSERT_EQ(physicsController_->getHandle(otherObjectName), cached.other);
+    ASSERT_TRUE(cached.touching);
+    ASSERT_FLOAT_EQ(-1.0f, cached.normal.x);
+    ASSERT_TRUE(bodies.contactCache[testIndex].empty());
 }
 
 /**
- * @brief Ensures that the edge point algorithm for collisions is functioning properly. This also ensures that
- * when an object updates and it passes through another, the epSign value properly tracks which face the
- * object was heading towards in the previous update.
+ * @brief Ensures the handle returned by addSceneObject is the same handle the name lookup finds.
  */
-TEST_F(GivenKinematicAndNonKinematicObject, WhenKinematicCollidesThrough_ThenObjectClipsToExpectedLocation) {
+TEST_F(GivenPhysicsControllerGeneral, WhenSceneObjectAdded_ThenHandleReturned) {
     /* Preparation */
-    deltaTime = 1.0f;
-    vec3 playerVel = vec3(0.0, -2.5f, 0.0f);
-    vec3 playerPos = vec3(0.0f, 2.0f, 0.0f);
-    vec3 mapPos = vec3(0.0f, 0.0f, 0.0f);
-    // Because of flushing, set velocity first
-    physicsController_->setVelocity(testObjectName, playerVel);
-    physicsController_->setPosition(testObjectName, playerPos);
-    physicsController_->setPosition(mapObjectName, mapPos);
+    TestObject testObject(testObjectName);
+    PhysicsParams params = { .isKinematic = true, .obeyGravity = false, .elasticity = 0.0f, .mass = testMassKg };
 
+    /* Action */
+    auto handle = physicsController_->addSceneObject(&testObject, params);
 
-    // Expected final positions
-    vec3 expectedPlayerFinalPos = vec3(0.0f, 1.0f, 0.0f);
-    vec3 expectedMapFinalPos = vec3(0.0f, 0.0f, 0.0f);
+    /* Validation */
+    ASSERT_NE(PHYS_INVALID_HANDLE, handle);
+    ASSERT_EQ(physicsController_->getHandle(testObjectName), handle);
+    ASSERT_EQ(PhysicsResult::OK, physicsController_->removeSceneObject(handle));
+    ASSERT_TRUE(physicsController_->getPhysicsObjects().empty());
+    ASSERT_EQ(PhysicsResult::FAILURE, physicsController_->removeSceneObject(handle));
+}
+
+/**
+ * @brief Ensures changes made through a handle are held until the next update, then applied in the order they were
+ * made before the bodies move.
+ */
+TEST_F(GivenPhysicsControllerPositionPipeline, WhenHandleSettersCalled_ThenChangesAppliedInOrderOnUpdate) {
+    /* Preparation */
+    deltaTime = 1.0f;
+    auto handle = physicsController_->getHandle(testObjectName);
+    vec3 startingPosition = vec3(1.0f, 0.0f, 0.0f);
+    vec3 targetVelocity = vec3(4.0f, 4.0f, 3.0f);
+    vec3 expectedPosition = vec3(5.0f, 4.0f, 3.0f);
+    physicsController_->setPosition(handle, vec3(-8.0f));
+    physicsController_->setPosition(handle, startingPosition);
+    physicsController_->setVelocity(handle, targetVelocity);
+    ASSERT_VEC_EQ(vec3(0.0f), testObject_->getPosition());
 
     /* Action */
     physicsController_->update();
 
     /* Validation */
-    // The second object should be moving, and the first should have a different velocity
-    vec3 actualPlayerFinalPos = testObject_->getPosition();
-    vec3 actualMapFinalPos = mapObject_->getPosition();
-    EXPECT_VEC_EQ(expectedPlayerFinalPos, actualPlayerFinalPos);
-    EXPECT_VEC_EQ(expectedMapFinalPos, actualMapFinalPos);
-
-    // Ensure that the objects are NO LONGER colliding after clipping to the edge point
-    auto isColl = testObject_->getCollider()->getCollision(mapObject_->getCollider());
-    ASSERT_NE(ALL_MATCH, isColl);
+    ASSERT_VEC_EQ(expectedPosition, testObject_->getPosition());
 }
 
-TEST_F(GivenKinematicAndNonKinematicObject, WhenKinematicCollidesWithCorner_ThenObjectClipsToExpectedLocation) {
+/**
+ * @brief Ensures changes made through a name and through a handle on the same body land in the order they were made.
+ */
+TEST_F(GivenPhysicsControllerPositionPipeline, WhenNamedAndHandleSettersMixed_ThenChangesAppliedInCallOrder) {
     /* Preparation */
     deltaTime = 1.0f;
-    vec3 playerVel = vec3(0.0, -2.5f, 0.0f);
+    auto handle = physicsController_->getHandle(testObjectName);
+    physicsController_->setVelocity(handle, vec3(10.0f, 0.0f, 0.0f));
+    physicsController_->setVelocity(testObjectName, vec3(0.0f));
+    physicsController_->setPosition(testObjectName, vec3(-5.0f));
+    physicsController_->setPosition(handle, vec3(2.0f, 0.0f, 0.0f));
+
+    /* Action */
+    physicsController_->update();
+
+    /* Validation */
+    ASSERT_VEC_EQ(vec3(2.0f, 0.0f, 0.0f), testObject_->getPosition());
+}
+
+/**
+ * @brief Ensures a full command queue never drops or reorders changes.
+ */
+TEST_F(GivenPhysicsControllerPositionPipeline, WhenCommandQueueOverflows_ThenLastChangeWins) {
+    /* Preparation */
+    deltaTime = 1.0f;
+    auto handle = physicsController_->getHandle(testObjectName);
+    uint commands = PHYS_COMMAND_QUEUE_SIZE * 2 + 3;
+
+    /* Action */
+    for (uint i = 0; i <= commands; ++i) {
+        ASSERT_EQ(PhysicsResult::OK, physicsController_->setPosition(handle, vec3(static_cast<float>(i))));
+    }
+    physicsController_->update();
+
+    /* Validation */
+    ASSERT_VEC_EQ(vec3(static_cast<float>(commands)), testObject_->getPosition());
+}
+
+/**
+ * @brief Ensures changes queued for a body that is removed before the next update are skipped.
+ */
+TEST_F(GivenPhysicsControllerPositionPipeline, WhenBodyRemovedWithQueuedChanges_ThenChangesSkipped) {
+    /* Preparation */
+    deltaTime = 1.0f;
+    auto handle = physicsController_->getHandle(testObjectName);
+    physicsController_->setPosition(handle, vec3(3.0f));
+    physicsController_->removeSceneObject(testObjectName);
+    // The replacement body may reuse the removed body's slot, but not its handle
+    physicsController_->addSceneObject(testObject_.get(), {
+        .isKinematic = false, .obeyGravity = false, .elasticity = 0.0f, .mass = testMassKg });
+
+    /* Action */
+    physicsController_->update();
+
+    /* Validation */
+    ASSERT_NE(handle, physicsController_->getHandle(testObjectName));
+    ASSERT_VEC_EQ(vec3(0.0f), testObject_->getPosition());
+}
+
+/**
+ * @brief Ensures commands pushed from several threads at once all come out exactly once, in the order each thread
+ * pushed them.
+ */
+TEST(GivenPhysicsCommandQueue, WhenPushedFromSeveralThreads_ThenEveryCommandPoppedInThreadOrder) {
+    /* Preparation */
+    PhysicsCommandQueue queue(64);
+    uint threadCount = 4;
+    uint commandsPerThread = 5000;
+    vector<std::thread> producers;
+    vector<uint> received(threadCount, 0);
+    uint total = 0;
+
+    /* Action */
+    for (uint t = 0; t < threadCount; ++t) {
+        producers.emplace_back([&queue, t, commandsPerThread]() {
+            for (uint i = 0; i < commandsPerThread; ++i) {
+                // Handle carries the producer, value carries the sequence number
+                PhysicsCommand command = { PhysicsCommandType::TRANSLATE, t, vec3(static_cast<float>(i)) };
+                while (!queue.push(command)) std::this_thread::yield();
+            }
+        });
+    }
+    PhysicsCommand command;
+    while (total < threadCount * commandsPerThread) {
+        if (!queue.pop(&command)) continue;
+        /* Validation */
+        ASSERT_LT(command.handle, threadCount);
+        ASSERT_FLOAT_EQ(static_cast<float>(received[command.handle]), command.value.x);
+        received[command.handle]++;
+        total++;
+    }
+    for (auto &producer : producers) producer.join();
+    ASSERT_FALSE(queue.pop(&command));
+}
+
+/**
+ * @brief Ensures bodies that can never move on their own start asleep and stay out of the pipeline.
+ */
+TEST_F(GivenPhysicsControllerPositionPipeline, WhenStaticBodyAdded_ThenBodyStartsAsleep) {
+    /* Preparation / Action */
+    auto po = physicsController_->getPhysicsObject(testObjectName);
+
+    /* Validation */
+    ASSERT_TRUE(po->asleep());
+    ASSERT_EQ(0, physicsController_->getActiveBodyCount());
+}
+
+/**
+ * @brief Ensures a kinematic body at rest goes to sleep after PHYS_SLEEP_FRAMES steps, and that setting its velocity
+ * wakes it back up.
+ */
+TEST_F(GivenTwoKinematicObjects, WhenBodiesRestForSleepFrames_ThenBodiesSleepUntilVelocitySet) {
+    /* Preparation */
+    deltaTime = 0.25f;
+    physicsController_->setPosition(testObjectName, vec3(0.0f));
+    physicsController_->setPosition(otherObjectName, vec3(10.0f, 0.0f, 0.0f));
+
+    /* Action */
+    for (int i = 0; i < PHYS_SLEEP_FRAMES; ++i) {
+        physicsController_->update();
+        if (i + 1 < PHYS_SLEEP_FRAMES) {
+            ASSERT_EQ(2, physicsController_->getActiveBodyCount()) << "Update " << i;
+        }
+    }
+
+    /* Validation */
+    ASSERT_EQ(0, physicsController_->getActiveBodyCount());
+    physicsController_->setVelocity(testObjectName, vec3(0.0f, 4.0f, 0.0f));
+    physicsController_->update();
+    ASSERT_EQ(1, physicsController_->getActiveBodyCount());
+    EXPECT_VEC_EQ(vec3(0.0f, 1.0f, 0.0f), testObject_->getPosition());
+    EXPECT_VEC_EQ(vec3(10.0f, 0.0f, 0.0f), otherObject_->getPosition());
+}
+
+/**
+ * @brief Ensures a sleeping kinematic body that gets hit wakes up and reacts in the same update, exactly as it would
+ * have if it had been awake.
+ */
+TEST_F(GivenTwoKinematicObjects, WhenSleepingBodyHit_ThenBodyWakesAndVelocitiesUpdatedAsExpected) {
+    /* Preparation */
+    deltaTime = 1.0f;
+    vec3 firstObjectVelocity = vec3(1.0f, 0.0f, 0.0f);
+    vec3 secondObjectPosition = vec3(basicModelOffset_ * 2 + 0.5f, 0.0f, 0.0f);
+    physicsController_->setPosition(testObjectName, vec3(0.0f, 10.0f, 0.0f));
+    physicsController_->setPosition(otherObjectName, secondObjectPosition);
+    for (int i = 0; i < PHYS_SLEEP_FRAMES; ++i) {
+        physicsController_->update();
+    }
+    ASSERT_EQ(0, physicsController_->getActiveBodyCount());
+    // Only the first object is woken by these calls
+    physicsController_->setPosition(testObjectName, vec3(0.0f));
+    physicsController_->setVelocity(testObjectName, firstObjectVelocity);
+
+    /* Action */
+    physicsController_->update();
+
+    /* Validation */
+    ASSERT_EQ(2, physicsController_->getActiveBodyCount());
+    // Same masses, so the first object stops and the second object takes all of its velocity
+    vec3 actualV1f = physicsController_->getPhysicsObject(testObjectName)->velocity();
+    vec3 actualV2f = physicsController_->getPhysicsObject(otherObjectName)->velocity();
+    EXPECT_VEC_EQ(vec3(0.0f), actualV1f);
+    EXPECT_VEC_EQ(firstObjectVelocity, actualV2f);
+}
+
+class GivenKinematicAndNonKinematicObject: public GivenPhysicsControllerPositionPipeline {
+ protected:
+    void SetUp() override {
+        physicsController_ = std::make_unique<PhysicsController>(6);
+        // Create the polygons for the test objects
+        basicModel_ = std::make_shared<Polygon>();
+
+        vector<float> bmVertices = {
+            // Dummy vertex points here - just want offset to be 1 and center 0
+            -1.0f, -1.0f, -1.0f,  // vertex 1
+            1.0f, 1.0f, 1.0f  // vertex 2
+        };
+        // This represents a flat X-Z plane that would be used as a map.
+        vector<float> mapVertices = {
+            -1.0f, 0.0f, -1.0f,
+            1.0f, 0.0f, 1.0f
+        };
+        basicModel_->modelMap["to"] = std::make_shared<Model>(bmVertices.size() / 3, bmVertices);
+        mapModel_ = std::make_shared<Polygon>();
+        mapModel_->modelMap["mo"] = std::make_shared<Model>(mapVertices.size() / 3, mapVertices);
+
+        mapObject_ = std::make_unique<TestObject>(mapModel_, mapObjectName);
+        mapObject_->setScale(10.0f);  // Make the map decently large
+        testObject_ = std::make_unique<TestObject>(basicModel_, testObjectName);
+        testObject_->createCollider("test");
+        mapObject_->createCollider("map");
+
+        // Use the same generic params for each object
+        PhysicsParams kinPar = {
+            .isKinematic = true,
+            .obeyGravity = false,
+            .elasticity = 0.0f,
+            .mass = testMassKg
+        };
+        PhysicsParams nonKinPar = {
+            .isKinematic = false,
+            .obeyGravity = false,
+            .elasticity = 0.0f,
+            .mass = testMassKg
+        };
+        physicsController_->addSceneObject(testObject_.get(), kinPar);
+        physicsController_->addSceneObject(mapObject_.get(), nonKinPar);
+    }
+    std::unique_ptr<TestObject> mapObject_;
+    std::shared_ptr<Polygon> basicModel_;
+    std::shared_ptr<Polygon> mapModel_;
+    inline static float basicModelOffset_ = 1.0f;
+};
+
+TEST_F(GivenKinematicAndNonKinematicObject, WhenKinematicCollidesNoPassthrough_ThenObjectClipsToExpectedLocation) {
+    /* Preparation */
+    deltaTime = 1.0f;
+    vec3 playerVel = vec3(0.0, -1.5f, 0.0f);
+    vec3 playerPos = vec3(0.0f, 2.0f, 0.0f);
+    vec3 mapPos = vec3(0.0f, 0.0f, 0.0f);
+    // Because of flushing, set velocity first
+    physicsController_->setVelocity(testObjectName, playerVel);
+    physicsController_->setPosition(testObjectName, playerPos);
+    physicsController_->setPosition(mapObjectName, mapPos);
+
+
+    // Expected final positions
+    vec3 expectedPlayerFinalPos = vec3(0.0f, 1.0f, 0.0f);
+    vec3 expectedMapFinalPos = vec3(0.0f, 0.0f, 0.0f);
+
+    /* Action */
+    physicsController_->update();
+
+    /* Validation */
+    // The second object should be moving, and the first should have a different velocity
+    vec3 actualPlayerFinalPos = testObject_->getPosition();
+    vec3 actualMapFinalPos = mapObject_->getPosition();
+    EXPECT_VEC_EQ(expectedPlayerFinalPos, actualPlayerFinalPos);
+    EXPECT_VEC_EQ(expectedMapFinalPos, actualMapFinalPos);
+
+    // Ensure that the objects are NO LONGER colliding after clipping to the edge point
+    auto isColl = testObject_->getCollider()->getCollision(mapObject_->getCollider());
+    ASSERT_NE(ALL_MATCH, isColl);
+}
+
+/**
+ * @brief Ensures that the edge point algorithm for collisions is functioning properly. This also ensures that
+ * when an object updates and it passes through another, the epSign value properly tracks which face the
+ * object was heading towards in the previous update.
+ */
+TEST_F(GivenKinematicAndNonKinematicObject, WhenKinematicCollidesThrough_ThenObjectClipsToExpectedLocation) {
+    /* Preparation */
+    deltaTime = 1.0f;
+    vec3 playerVel = vec3(0.0, -2.5f, 0.0f);
+    vec3 playerPos = vec3(0.0f, 2.0f, 0.0f);
+    vec3 mapPos = vec3(0.0f, 0.0f, 0.0f);
+    // Because of flushing, set velocity first
+    physicsController_->setVelocity(testObjectName, playerVel);
+    physicsController_->setPosition(testObjectName, playerPos);
+    physicsController_->setPosition(mapObjectName, mapPos);
+
+
+    // Expected final positions
+    vec3 expectedPlayerFinalPos = vec3(0.0f, 1.0f, 0.0f);
+    vec3 expectedMapFinalPos = vec3(0.0f, 0.0f, 0.0f);
+
+    /* Action */
+    physicsController_->update();
+
+    /* Validation */
+    // The second object should be moving, and the first should have a different velocity
+    vec3 actualPlayerFinalPos = testObject_->getPosition();
+    vec3 actualMapFinalPos = mapObject_->getPosition();
+    EXPECT_VEC_EQ(expectedPlayerFinalPos, actualPlayerFinalPos);
+    EXPECT_VEC_EQ(expectedMapFinalPos, actualMapFinalPos);
+
+    // Ensure that the objects are NO LONGER colliding after clipping to the edge point
+    auto isColl = testObject_->getCollider()->getCollision(mapObject_->getCollider());
+    ASSERT_NE(ALL_MATCH, isColl);
+}
+
+TEST_F(GivenKinematicAndNonKinematicObject, WhenKinematicCollidesWithCorner_ThenObjectClipsToExpectedLocation) {
+    /* Preparation */
+    deltaTime = 1.0f;
+    vec3 playerVel = vec3(0.0, -2.5f, 0.0f);
     vec3 playerPos = vec3(9.5f, 2.0f, 9.5f);
     vec3 mapPos = vec3(0.0f, 0.0f, 0.0f);
     // Because of flushing, set velocity first
@@ -832,7 +1368,7 @@ TEST_F(GivenKinematicAndNonKinematicObject,
     physicsController_->setPosition(mapObjectName, mapPos);
 
     // Enable gravity for player
-    physicsController_->getPhysicsObject(testObjectName)->obeyGravity = true;
+    physicsController_->getPhysicsObject(testObjectName)->obeyGravity() = true;
 
     // Expected player final position
     vec3 epfp_update1 = vec3(9.5f, 1.0f, 10.5f);
@@ -944,6 +1480,179 @@ TEST_F(GivenKinematicAndNonKinematicObject, WhenKinematicCollidesWithCornerAndRi
 }
 
 /* Gravity based tests */
+/**
+ * @brief Ensures a fast object passes through the map in a single step without continuous collision, and is caught
+ * on top of the map with it.
+ */
+TEST_F(GivenKinematicAndNonKinematicObject, WhenFastObjectCrossesMap_ThenOnlyContinuousObjectCaught) {
+    /* Preparation */
+    deltaTime = 1.0f;
+    vec3 playerVel = vec3(0.0f, -20.0f, 0.0f);
+    vec3 playerPos = vec3(0.0f, 5.0f, 0.0f);
+    physicsController_->setPosition(mapObjectName, vec3(0.0f));
+    auto fastObject = std::make_unique<TestObject>(basicModel_, "fastObject");
+    fastObject->createCollider("fast");
+    PhysicsParams params = {
+        .isKinematic = true,
+        .obeyGravity = false,
+        .elasticity = 0.0f,
+        .mass = testMassKg,
+        .continuousCollision = true
+    };
+    physicsController_->addSceneObject(fastObject.get(), params);
+    physicsController_->setPosition(testObjectName, playerPos);
+    physicsController_->setVelocity(testObjectName, playerVel);
+    // Far enough along x that the two objects never touch each other
+    physicsController_->setPosition("fastObject", playerPos + vec3(5.0f, 0.0f, 0.0f));
+    physicsController_->setVelocity("fastObject", playerVel);
+
+    /* Action */
+    physicsController_->update();
+
+    /* Validation */
+    EXPECT_VEC_EQ(vec3(0.0f, -15.0f, 0.0f), testObject_->getPosition());
+    EXPECT_VEC_EQ(vec3(5.0f, 1.0f, 0.0f), fastObject->getPosition());
+    auto isColl = fastObject->getCollider()->getCollision(mapObject_->getCollider());
+    ASSERT_NE(ALL_MATCH, isColl);
+}
+
+/**
+ * @brief Ensures a kinematic object pushing into the map is reported as a contact that begins, persists while the
+ * object keeps pushing, and ends once the object moves away.
+ */
+TEST_F(GivenKinematicAndNonKinematicObject, WhenSubscribed_ThenContactBeginPersistEndReported) {
+    /* Preparation */
+    deltaTime = 1.0f;
+    vector<PhysicsReport> reports;
+    physicsController_->subscribe("test", [&reports](const PhysicsReport &report) { reports.push_back(report); });
+    physicsController_->setVelocity(testObjectName, vec3(0.0, -1.5f, 0.0f));
+    physicsController_->setPosition(testObjectName, vec3(0.0f, 2.0f, 0.0f));
+    physicsController_->setPosition(mapObjectName, vec3(0.0f));
+    auto playerHandle = physicsController_->getHandle(testObjectName);
+    auto mapHandle = physicsController_->getHandle(mapObjectName);
+    PhysicsContactType expectedTypes[] = {
+        PhysicsContactType::BEGIN, PhysicsContactType::PERSIST, PhysicsContactType::END
+    };
+
+    /* Action */
+    physicsController_->update();
+    physicsController_->update();
+    physicsController_->setVelocity(testObjectName, vec3(0.0, 4.0f, 0.0f));
+    physicsController_->update();
+    physicsController_->update();
+
+    /* Validation */
+    // The last update has no contact changes, so it sends no report
+    ASSERT_EQ(3, reports.size());
+    for (uint i = 0; i < reports.size(); ++i) {
+        ASSERT_EQ(i + 1, reports[i].step);
+        ASSERT_EQ(1, reports[i].contacts.size());
+        auto &contact = reports[i].contacts[0];
+        EXPECT_EQ(expectedTypes[i], contact.type) << "Report " << i;
+        EXPECT_EQ(std::min(playerHandle, mapHandle), contact.body);
+        EXPECT_EQ(std::max(playerHandle, mapHandle), contact.other);
+        auto playerObject = contact.body == playerHandle ? contact.bodyObject : contact.otherObject;
+        auto mapObject = contact.body == mapHandle ? contact.bodyObject : contact.otherObject;
+        EXPECT_EQ(testObject_.get(), playerObject);
+        EXPECT_EQ(mapObject_.get(), mapObject);
+    }
+}
+
+/**
+ * @brief Ensures two objects whose layers are excluded by each other's masks pass through each other untouched.
+ */
+TEST_F(GivenTwoKinematicObjects, WhenLayersFilteredByCollider_ThenObjectsPassThrough) {
+    /* Preparation */
+    deltaTime = 1.0f;
+    uint32_t projectileLayer = 2;
+    // Projectiles hit everything except other projectiles
+    testObject_->createCollider("test", projectileLayer, ~projectileLayer);
+    otherObject_->createCollider("other", projectileLayer, ~projectileLayer);
+    vec3 secondObjectPosition = vec3(basicModelOffset_ * 2 + 0.5f, 0.0f, 0.0f);
+    vec3 firstObjectVelocity = vec3(1.0f, 0.0f, 0.0f);
+    physicsController_->setPosition(testObjectName, vec3(0.0f));
+    physicsController_->setPosition(otherObjectName, secondObjectPosition);
+    physicsController_->setVelocity(testObjectName, firstObjectVelocity);
+
+    /* Action */
+    physicsController_->update();
+
+    /* Validation */
+    EXPECT_VEC_EQ(firstObjectVelocity, testObject_->getPosition());
+    EXPECT_VEC_EQ(secondObjectPosition, otherObject_->getPosition());
+    EXPECT_VEC_EQ(firstObjectVelocity, physicsController_->getPhysicsObject(testObjectName)->velocity());
+    EXPECT_VEC_EQ(vec3(0.0f), physicsController_->getPhysicsObject(otherObjectName)->velocity());
+    ASSERT_EQ(ALL_MATCH, testObject_->getCollider()->getCollision(otherObject_->getCollider()));
+}
+
+/**
+ * @brief Ensures a collision filter passed in PhysicsParams is written to the collider, and that filtering only one
+ * side of a pair is enough to skip it.
+ */
+TEST_F(GivenTwoKinematicObjects, WhenMaskSetThroughParams_ThenObjectsPassThrough) {
+    /* Preparation */
+    deltaTime = 1.0f;
+    PhysicsParams params = {
+        .isKinematic = true,
+        .obeyGravity = false,
+        .elasticity = 0.0f,
+        .mass = testMassKg,
+        .continuousCollision = false,
+        .collisionLayer = 8,
+        .collisionMask = ~COLLIDER_LAYER_DEFAULT
+    };
+    physicsController_->addSceneObject(testObject_.get(), params);
+    vec3 secondObjectPosition = vec3(basicModelOffset_ * 2 + 0.5f, 0.0f, 0.0f);
+    vec3 firstObjectVelocity = vec3(1.0f, 0.0f, 0.0f);
+    physicsController_->setPosition(testObjectName, vec3(0.0f));
+    physicsController_->setPosition(otherObjectName, secondObjectPosition);
+    physicsController_->setVelocity(testObjectName, firstObjectVelocity);
+
+    /* Action */
+    physicsController_->update();
+
+    /* Validation */
+    ASSERT_EQ(8, testObject_->getCollider()->layer());
+    ASSERT_EQ(~COLLIDER_LAYER_DEFAULT, testObject_->getCollider()->mask());
+    // The other object still accepts every layer, but the test object rejects the other object's layer
+    EXPECT_VEC_EQ(firstObjectVelocity, testObject_->getPosition());
+    EXPECT_VEC_EQ(secondObjectPosition, otherObject_->getPosition());
+}
+
+/**
+ * @brief Ensures a contact between two kinematic objects, which both objects detect, is only reported once, and that
+ * an unsubscribed callback stops receiving reports.
+ */
+TEST_F(GivenTwoKinematicObjects, WhenObjectsCollide_ThenContactReportedOnce) {
+    /* Preparation */
+    deltaTime = 1.0f;
+    vector<PhysicsReport> reports;
+    vector<PhysicsReport> laterReports;
+    physicsController_->subscribe("test", [&reports](const PhysicsReport &report) { reports.push_back(report); });
+    physicsController_->setPosition(testObjectName, vec3(0.0f));
+    physicsController_->setPosition(otherObjectName, vec3(basicModelOffset_ * 2 + 0.5f, 0.0f, 0.0f));
+    physicsController_->setVelocity(testObjectName, vec3(1.0f, 0.0f, 0.0f));
+    physicsController_->setVelocity(otherObjectName, vec3(-1.0f, 0.0f, 0.0f));
+
+    /* Action */
+    physicsController_->update();
+    ASSERT_EQ(PhysicsResult::OK, physicsController_->unsubscribe("test"));
+    physicsController_->subscribe("later", [&laterReports](const PhysicsReport &report) {
+        laterReports.push_back(report);
+    });
+    physicsController_->update();
+
+    /* Validation */
+    ASSERT_EQ(1, reports.size());
+    ASSERT_EQ(1, reports[0].contacts.size());
+    EXPECT_EQ(PhysicsContactType::BEGIN, reports[0].contacts[0].type);
+    // The objects bounced apart on the first update, so the new subscriber only hears about the contact ending
+    ASSERT_EQ(1, laterReports.size());
+    ASSERT_EQ(1, laterReports[0].contacts.size());
+    EXPECT_EQ(PhysicsContactType::END, laterReports[0].contacts[0].type);
+    ASSERT_EQ(PhysicsResult::FAILURE, physicsController_->unsubscribe("test"));
+}
+
 class GivenPhysicsControllerWithGravity: public ::testing::Test {
  protected:
     void SetUp() override {
@@ -1054,15 +1763,15 @@ TEST_F(GivenCrushCollision, WhenMiddleIsCrushedAfterTwoUpdates_ThenWillPopOut) {
 
     auto expectedFinalPos = vec3(0.0f);
     // Disable kinematics for left and right
-    left->isKinematic = false;
-    right->isKinematic = false;
+    left->isKinematic() = false;
+    right->isKinematic() = false;
     // Set starting positions
     physicsController_->setPosition(TEST_OBJ_PRE("-left"), vec3(-1.5f, 0.0f, 0.0f));
     physicsController_->setPosition(TEST_OBJ_PRE("-middle"), vec3(0.0f, 0.0f, 0.0f));
     physicsController_->setPosition(TEST_OBJ_PRE("-right"), vec3(1.5f, 0.0f, 0.0f));
     // Set velocities of left and right
-    left->velocity = vec3(1.0f, 0.0f, 0.0f);
-    right->velocity = vec3(-1.0f, 0.0f, 0.0f);
+    left->velocity() = vec3(1.0f, 0.0f, 0.0f);
+    right->velocity() = vec3(-1.0f, 0.0f, 0.0f);
 
     /* Action */
     physicsController_->update();
@@ -1075,10 +1784,705 @@ TEST_F(GivenCrushCollision, WhenMiddleIsCrushedAfterTwoUpdates_ThenWillPopOut) {
     physicsController_->update();
 
     /* Validation */
-    auto actualFinalPos = middle->target->getPosition();
+    auto actualFinalPos = middle->target()->getPosition();
     ASSERT_VEC_EQ(expectedFinalPos, actualFinalPos);
 }
 
+/**
+ * @brief Ensures the contact solver separates a row of kinematic boxes sunk into each other. Answering each contact
+ * once leaves the middle box pushed from both sides, so without the solver the row stays overlapped.
+ */
+TEST_F(GivenCrushCollision, WhenRowOverlapsWithSolver_ThenBoxesSeparated) {
+    deltaTime = 0.1f;
+    /* Preparation */
+    auto left = physicsController_->getPhysicsObject(TEST_OBJ_PRE("-left"));
+    auto middle = physicsController_->getPhysicsObject(TEST_OBJ_PRE("-middle"));
+    auto right = physicsController_->getPhysicsObject(TEST_OBJ_PRE("-right"));
+    // Returns the deepest overlap between neighbouring boxes, which are two units wide
+    auto worstOverlap = [&]() {
+        auto leftGap = middle->target()->getPosition().x - left->target()->getPosition().x;
+        auto rightGap = right->target()->getPosition().x - middle->target()->getPosition().x;
+        return 2.0f - std::min(leftGap, rightGap);
+    };
+    physicsController_->setPosition(TEST_OBJ_PRE("-left"), vec3(-1.5f, 0.0f, 0.0f));
+    physicsController_->setPosition(TEST_OBJ_PRE("-middle"), vec3(0.0f, 0.0f, 0.0f));
+    physicsController_->setPosition(TEST_OBJ_PRE("-right"), vec3(1.5f, 0.0f, 0.0f));
+    physicsController_->setSolverIterations(0);
+    physicsController_->update();
+    auto unsolvedOverlap = worstOverlap();
+
+    /* Action */
+    physicsController_->setSolverIterations(16);
+    physicsController_->update();
+
+    /* Validation */
+    ASSERT_GT(unsolvedOverlap, 0.1f);
+    ASSERT_LT(worstOverlap(), 0.01f);
+    // Pushed apart evenly, so the middle box stays put
+    ASSERT_NEAR(0.0f, middle->target()->getPosition().x, 1e-4f);
+    ASSERT_NEAR(0.0f, left->target()->getPosition().y, 1e-4f);
+}
+
+/**
+ * @brief Ensures the contact solver warm starts from the contact cache. Once a step has shown the middle box of the
+ * row is pinned, a single pass is enough to separate the row when it is squeezed together again.
+ */
+TEST_F(GivenCrushCollision, WhenRowOverlapsAgain_ThenWarmStartedSolverSeparatesInOnePass) {
+    deltaTime = 0.1f;
+    /* Preparation */
+    auto left = physicsController_->getPhysicsObject(TEST_OBJ_PRE("-left"));
+    auto middle = physicsController_->getPhysicsObject(TEST_OBJ_PRE("-middle"));
+    auto right = physicsController_->getPhysicsObject(TEST_OBJ_PRE("-right"));
+    auto squeezeRow = [&]() {
+        physicsController_->setPosition(TEST_OBJ_PRE("-left"), vec3(-1.5f, 0.0f, 0.0f));
+        physicsController_->setPosition(TEST_OBJ_PRE("-middle"), vec3(0.0f, 0.0f, 0.0f));
+        physicsController_->setPosition(TEST_OBJ_PRE("-right"), vec3(1.5f, 0.0f, 0.0f));
+    };
+    auto worstOverlap = [&]() {
+        auto leftGap = middle->target()->getPosition().x - left->target()->getPosition().x;
+        auto rightGap = right->target()->getPosition().x - middle->target()->getPosition().x;
+        return 2.0f - std::min(leftGap, rightGap);
+    };
+    // A cold single pass splits every contact evenly, so the pinned middle box leaves part of each overlap
+    physicsController_->setSolverIterations(1);
+    squeezeRow();
+    physicsController_->update();
+    auto coldOverlap = worstOverlap();
+    // Let the solver settle the row once so the cache learns how the contacts were shared
+    physicsController_->setSolverIterations(16);
+    squeezeRow();
+    physicsController_->update();
+
+    /* Action */
+    physicsController_->setSolverIterations(1);
+    squeezeRow();
+    physicsController_->update();
+
+    /* Validation */
+    ASSERT_GT(coldOverlap, 0.1f);
+    ASSERT_LT(worstOverlap(), 0.01f);
+    ASSERT_NEAR(0.0f, middle->target()->getPosition().x, 1e-4f);
+}
+
+// Builds the same scene in two controllers so the spatial hash can be A/B tested against brute force
+class GivenBroadphaseComparison: public ::testing::Test {
+ protected:
+    void SetUp() override {
+        bruteController_ = std::make_unique<PhysicsController>(6);
+        hashController_ = std::make_unique<PhysicsController>(6);
+        bruteController_->setBroadphase(PhysicsBroadphase::BRUTE_FORCE);
+        hashController_->setBroadphase(PhysicsBroadphase::SPATIAL_HASH);
+        boxModel_ = std::make_shared<Polygon>();
+        vector<float> boxVertices = {
+            -0.5f, -0.5f, -0.5f,
+            0.5f, 0.5f, 0.5f
+        };
+        vector<float> tileVertices = {
+            -1.0f, 0.0f, -1.0f,
+            1.0f, 0.0f, 1.0f
+        };
+        boxModel_->modelMap["box"] = std::make_shared<Model>(boxVertices.size() / 3, boxVertices);
+        tileModel_ = std::make_shared<Polygon>();
+        tileModel_->modelMap["tile"] = std::make_shared<Model>(tileVertices.size() / 3, tileVertices);
+        buildScene(bruteController_.get(), &bruteObjects_);
+        buildScene(hashController_.get(), &hashObjects_);
+    }
+
+    // A floor of tiles with a handful of falling boxes spread across it
+    void buildScene(PhysicsController *controller, vector<std::shared_ptr<TestObject>> *objects) {
+        PhysicsParams tilePar = {
+            .isKinematic = false,
+            .obeyGravity = false,
+            .elasticity = 0.0f,
+            .mass = testMassKg
+        };
+        PhysicsParams boxPar = {
+            .isKinematic = true,
+            .obeyGravity = true,
+            .elasticity = 0.0f,
+            .mass = testMassKg
+        };
+        for (int x = 0; x < tileCount_; ++x) {
+            for (int z = 0; z < tileCount_; ++z) {
+                auto tile = std::make_shared<TestObject>(tileModel_,
+                    "tile-" + to_string(x) + "-" + to_string(z));
+                tile->setPosition(vec3(x * 2.0f, 0.0f, z * 2.0f));
+                tile->createCollider("tile");
+                controller->addSceneObject(tile.get(), tilePar);
+                objects->push_back(tile);
+            }
+        }
+        for (int i = 0; i < boxCount_; ++i) {
+            auto name = "box-" + to_string(i);
+            auto box = std::make_shared<TestObject>(boxModel_, name);
+            box->createCollider("box");
+            controller->addSceneObject(box.get(), boxPar);
+            controller->setPosition(name, vec3(i * 4.0f, 1.0f, i * 2.0f + 4.0f));
+            controller->setVelocity(name, vec3(0.2f, 0.0f, -0.2f));
+            objects->push_back(box);
+        }
+    }
+    std::unique_ptr<PhysicsController> bruteController_;
+    std::unique_ptr<PhysicsController> hashController_;
+    vector<std::shared_ptr<TestObject>> bruteObjects_;
+    vector<std::shared_ptr<TestObject>> hashObjects_;
+    std::shared_ptr<Polygon> boxModel_;
+    std::shared_ptr<Polygon> tileModel_;
+    inline static int tileCount_ = 10;
+    inline static int boxCount_ = 5;
+};
+
+/**
+ * @brief Ensures the spatial hash is the default broadphase.
+ */
+TEST(GivenPhysicsController, WhenConstructed_ThenSpatialHashBroadphaseSelected) {
+    /* Preparation */
+    auto physicsController = std::make_unique<PhysicsController>(1);
+
+    /* Action / Validation */
+    ASSERT_EQ(PhysicsBroadphase::SPATIAL_HASH, physicsController->getBroadphase());
+}
+
+/**
+ * @brief Ensures that the spatial hash finds every pair brute force does. Both controllers get identical scenes, so
+ * positions and velocities must match exactly after several updates with boxes landing on a tiled floor.
+ */
+TEST_F(GivenBroadphaseComparison, WhenSceneUpdated_ThenSpatialHashMatchesBruteForce) {
+    /* Preparation */
+    deltaTime = 0.25f;
+    int updates = 8;
+
+    /* Action */
+    for (int i = 0; i < updates; ++i) {
+        bruteController_->update();
+        hashController_->update();
+    }
+
+    /* Validation */
+    ASSERT_EQ(bruteObjects_.size(), hashObjects_.size());
+    for (uint i = 0; i < bruteObjects_.size(); ++i) {
+        auto name = bruteObjects_[i]->objectName();
+        vec3 expectedPos = bruteObjects_[i]->getPosition();
+        vec3 actualPos = hashObjects_[i]->getPosition();
+        vec3 expectedVel = bruteController_->getPhysicsObject(name)->velocity();
+        vec3 actualVel = hashController_->getPhysicsObject(name)->velocity();
+        ASSERT_VEC_EQ(expectedPos, actualPos);
+        ASSERT_VEC_EQ(expectedVel, actualVel);
+    }
+    // The boxes should have been caught by the floor - free falling for two seconds would put them near y = -18
+    for (int i = 0; i < boxCount_; ++i) {
+        auto box = hashController_->getPhysicsObject("box-" + to_string(i));
+        EXPECT_GT(box->target()->getPosition().y, -1.0f);
+    }
+}
+
+/**
+ * @brief Ensures the spatial hash still works when the cell size is much smaller than the objects, forcing objects
+ * to span several cells.
+ */
+TEST_F(GivenBroadphaseComparison, WhenCellSizeSmall_ThenSpatialHashMatchesBruteForce) {
+    /* Preparation */
+    deltaTime = 0.25f;
+    int updates = 4;
+    hashController_->setBroadphaseCellSize(0.3f);
+
+    /* Action */
+    for (int i = 0; i < updates; ++i) {
+        bruteController_->update();
+        hashController_->update();
+    }
+
+    /* Validation */
+    for (uint i = 0; i < bruteObjects_.size(); ++i) {
+        vec3 expectedPos = bruteObjects_[i]->getPosition();
+        vec3 actualPos = hashObjects_[i]->getPosition();
+        ASSERT_VEC_EQ(expectedPos, actualPos);
+    }
+}
+
+/**
+ * @brief Ensures a ray and a box cast straight down onto the floor hit the tile below them, and that a mask without
+ * the floor's layer ignores it.
+ */
+TEST_F(GivenBroadphaseComparison, WhenRaycastAndSweepDown_ThenFloorTileHit) {
+    /* Preparation */
+    deltaTime = 0.25f;
+    hashController_->update();
+    PhysicsQueryHit rayHit;
+    PhysicsQueryHit sweepHit;
+    PhysicsQueryHit maskedHit;
+    auto origin = vec3(2.0f, 10.0f, 0.0f);
+
+    /* Action */
+    auto rayResult = hashController_->raycast(origin, vec3(0.0f, -1.0f, 0.0f), 50.0f, &rayHit);
+    auto sweepResult = hashController_->sweepBox(origin, vec3(0.5f), vec3(0.0f, -2.0f, 0.0f), 50.0f, &sweepHit);
+    auto maskedResult = hashController_->raycast(origin, vec3(0.0f, -1.0f, 0.0f), 50.0f, &maskedHit,
+        ~COLLIDER_LAYER_DEFAULT);
+
+    /* Validation */
+    ASSERT_TRUE(rayResult);
+    EXPECT_EQ(hashController_->getHandle("tile-1-0"), rayHit.handle);
+    EXPECT_EQ("tile-1-0", rayHit.object->objectName());
+    EXPECT_NEAR(10.0f, rayHit.distance, 1e-3f);
+    EXPECT_VEC_EQ(vec3(0.0f, 1.0f, 0.0f), rayHit.normal);
+    ASSERT_TRUE(sweepResult);
+    EXPECT_EQ(hashController_->getHandle("tile-1-0"), sweepHit.handle);
+    EXPECT_NEAR(9.5f, sweepHit.distance, 1e-3f);
+    ASSERT_FALSE(maskedResult);
+}
+
+/**
+ * @brief Ensures overlapBox returns exactly the floor tiles inside the box, in ascending handle order.
+ */
+TEST_F(GivenBroadphaseComparison, WhenOverlapBoxQueried_ThenTilesInsideReturned) {
+    /* Preparation */
+    deltaTime = 0.25f;
+    hashController_->update();
+    vector<PhysicsQueryHit> hits;
+
+    /* Action */
+    auto count = hashController_->overlapBox(vec3(12.0f, 0.0f, 2.0f), vec3(1.5f, 0.25f, 1.5f), &hits);
+
+    /* Validation */
+    // Spans tiles 5 to 7 on x and 0 to 2 on z, and stays clear of every box
+    ASSERT_EQ(9u, count);
+    ASSERT_EQ(9u, hits.size());
+    for (uint i = 0; i < hits.size(); ++i) {
+        auto name = hits[i].object->objectName();
+        EXPECT_EQ(hashController_->getHandle(name), hits[i].handle);
+        EXPECT_EQ(0u, name.find("tile-"));
+        if (i > 0) {
+            EXPECT_LT(hits[i - 1].handle, hits[i].handle);
+        }
+    }
+}
+
+/**
+ * @brief Ensures scene queries can run from several threads while the PhysicsController keeps updating, and always
+ * see a complete snapshot.
+ */
+TEST_F(GivenBroadphaseComparison, WhenQueriedDuringUpdates_ThenEveryRaycastHitsFloor) {
+    /* Preparation */
+    deltaTime = 0.05f;
+    hashController_->update();
+    std::atomic<bool> done { false };
+    std::atomic<uint> misses { 0 };
+    std::atomic<uint> queries { 0 };
+    vector<std::thread> queryThreads;
+
+    /* Action */
+    for (int t = 0; t < 4; ++t) {
+        queryThreads.emplace_back([&, t]() {
+            PhysicsQueryHit hit;
+            while (!done.load()) {
+                // Rays between the falling boxes, so the floor is always the first thing hit
+                auto origin = vec3(1.0f + t * 4.0f, 10.0f, 0.0f);
+                if (!hashController_->raycast(origin, vec3(0.0f, -1.0f, 0.0f), 20.0f, &hit)) misses++;
+                queries++;
+            }
+        });
+    }
+    for (int i = 0; i < 20; ++i) {
+        hashController_->update();
+    }
+    done = true;
+    for (auto &thread : queryThreads) thread.join();
+
+    /* Validation */
+    EXPECT_GT(queries.load(), 0u);
+    EXPECT_EQ(0u, misses.load());
+}
+
+/**
+ * @brief Ensures the spatial hash walk in PhysicsQueryWorld finds the same hits as a world where every box shares
+ * a single cell, which degenerates to testing every box.
+ */
+TEST(GivenPhysicsQueryWorld, WhenRandomRaysAndSweepsCast_ThenHashMatchesSingleCell) {
+    /* Preparation */
+    PhysicsQueryWorld hashed(1.0f);
+    PhysicsQueryWorld single(1e6f);
+    std::mt19937 rng(99);
+    std::uniform_real_distribution<float> position(-20.0f, 20.0f);
+    std::uniform_real_distribution<float> extent(0.0f, 2.0f);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+    for (uint i = 0; i < 300; ++i) {
+        auto center = vec3(position(rng), position(rng), position(rng));
+        auto offset = vec3(extent(rng), extent(rng), extent(rng));
+        // A few oversized boxes, so the oversized list is exercised too
+        if (i % 50 == 0) offset *= 10.0f;
+        uint32_t layer = 1u << (i % 3);
+        hashed.add(i, nullptr, layer, center - offset, center + offset);
+        single.add(i, nullptr, layer, center - offset, center + offset);
+    }
+
+    for (uint i = 0; i < 500; ++i) {
+        auto origin = vec3(position(rng), position(rng), position(rng));
+        auto direction = vec3(unit(rng), unit(rng), unit(rng));
+        uint32_t mask = (i % 4 == 0) ? 2u : COLLIDER_MASK_ALL;
+        PhysicsQueryHit expected, actual;
+
+        /* Action */
+        auto expectedRay = single.raycast(origin, direction, 30.0f, mask, &expected);
+        auto actualRay = hashed.raycast(origin, direction, 30.0f, mask, &actual);
+
+        /* Validation */
+        ASSERT_EQ(expectedRay, actualRay) << "Ray " << i;
+        if (expectedRay) {
+            ASSERT_EQ(expected.handle, actual.handle) << "Ray " << i;
+            ASSERT_FLOAT_EQ(expected.distance, actual.distance) << "Ray " << i;
+        }
+
+        /* Action */
+        auto expectedSweep = single.sweepBox(origin, vec3(0.5f), direction, 10.0f, mask, &expected);
+        auto actualSweep = hashed.sweepBox(origin, vec3(0.5f), direction, 10.0f, mask, &actual);
+
+        /* Validation */
+        ASSERT_EQ(expectedSweep, actualSweep) << "Sweep " << i;
+        if (expectedSweep) {
+            ASSERT_EQ(expected.handle, actual.handle) << "Sweep " << i;
+        }
+    }
+}
+
+class GivenMeshColliderFloor: public ::testing::Test {
+ protected:
+    void SetUp() override {
+        physicsController_ = std::make_unique<PhysicsController>(6);
+        boxModel_ = std::make_shared<Polygon>();
+        vector<float> boxVertices = {
+            -1.0f, -1.0f, -1.0f,
+            1.0f, 1.0f, 1.0f
+        };
+        boxModel_->modelMap["box"] = std::make_shared<Model>(boxVertices.size() / 3, boxVertices);
+        // A single triangle covering the half of the [-10, 10] square where x + z <= 0
+        floorModel_ = std::make_shared<Polygon>();
+        vector<float> floorVertices = {
+            -10.0f, 0.0f, -10.0f,
+            10.0f, 0.0f, -10.0f,
+            -10.0f, 0.0f, 10.0f
+        };
+        floorModel_->modelMap["floor"] = std::make_shared<Model>(floorVertices.size() / 3, floorVertices);
+        floor_ = std::make_unique<TestObject>(floorModel_, "meshFloor");
+        floor_->createCollider("floor");
+        floorHandle_ = physicsController_->addSceneObject(floor_.get(), {
+            .isKinematic = false,
+            .obeyGravity = false,
+            .elasticity = 0.0f,
+            .mass = testMassKg,
+            .mesh = MeshCollider::fromPolygon(*floorModel_)
+        });
+        onTriangle_ = addBox("onTriangle", vec3(-5.0f, 2.0f, -5.0f));
+        offTriangle_ = addBox("offTriangle", vec3(5.0f, 2.0f, 5.0f));
+    }
+    std::unique_ptr<TestObject> addBox(string name, vec3 position) {
+        auto box = std::make_unique<TestObject>(boxModel_, name);
+        box->createCollider("box");
+        physicsController_->addSceneObject(box.get(), {
+            .isKinematic = true,
+            .obeyGravity = false,
+            .elasticity = 0.0f,
+            .mass = testMassKg
+        });
+        physicsController_->setVelocity(name, vec3(0.0f, -1.5f, 0.0f));
+        physicsController_->setPosition(name, position);
+        return box;
+    }
+    std::unique_ptr<PhysicsController> physicsController_;
+    std::shared_ptr<Polygon> boxModel_;
+    std::shared_ptr<Polygon> floorModel_;
+    std::unique_ptr<TestObject> floor_;
+    std::unique_ptr<TestObject> onTriangle_;
+    std::unique_ptr<TestObject> offTriangle_;
+    PhysicsHandle floorHandle_;
+};
+
+/**
+ * @brief Ensures a box landing on a mesh collider's triangle is stopped, while a box falling through the part of the
+ * mesh's bounds the triangle does not cover passes through.
+ */
+TEST_F(GivenMeshColliderFloor, WhenBoxesFall_ThenOnlyBoxOverTriangleCaught) {
+    /* Preparation */
+    deltaTime = 1.0f;
+
+    /* Action */
+    physicsController_->update();
+
+    /* Validation */
+    EXPECT_VEC_EQ(vec3(-5.0f, 1.0f, -5.0f), onTriangle_->getPosition());
+    EXPECT_VEC_EQ(vec3(5.0f, 0.5f, 5.0f), offTriangle_->getPosition());
+    // The whole mesh is still a single body
+    ASSERT_EQ(3u, physicsController_->getBodies().size());
+}
+
+/**
+ * @brief Ensures scene queries test a mesh collider's triangles rather than its bounds.
+ */
+TEST_F(GivenMeshColliderFloor, WhenQueried_ThenTrianglesTestedInsteadOfBounds) {
+    /* Preparation */
+    deltaTime = 1.0f;
+    physicsController_->update();
+    PhysicsQueryHit hit;
+    PhysicsQueryHit missed;
+    vector<PhysicsQueryHit> overlapHits;
+    vector<PhysicsQueryHit> outsideHits;
+
+    /* Action */
+    auto hitResult = physicsController_->raycast(vec3(-2.0f, 10.0f, -7.0f), vec3(0.0f, -1.0f, 0.0f), 20.0f, &hit);
+    auto missResult = physicsController_->raycast(vec3(3.0f, 10.0f, -1.0f), vec3(0.0f, -1.0f, 0.0f), 20.0f,
+        &missed);
+    physicsController_->overlapBox(vec3(-8.0f, 0.0f, 2.0f), vec3(0.5f), &overlapHits);
+    physicsController_->overlapBox(vec3(8.0f, 0.0f, -2.0f), vec3(0.5f), &outsideHits);
+
+    /* Validation */
+    ASSERT_TRUE(hitResult);
+    EXPECT_EQ(floorHandle_, hit.handle);
+    EXPECT_NEAR(10.0f, hit.distance, 1e-3f);
+    EXPECT_VEC_EQ(vec3(0.0f, 1.0f, 0.0f), hit.normal);
+    ASSERT_FALSE(missResult);
+    ASSERT_EQ(1u, overlapHits.size());
+    EXPECT_EQ(floorHandle_, overlapHits[0].handle);
+    ASSERT_TRUE(outsideHits.empty());
+}
+
+// Builds the same crowded scene in a single threaded and a multithreaded controller running in deterministic mode
+class GivenDeterministicControllers: public ::testing::Test {
+ protected:
+    void SetUp() override {
+        singleController_ = std::make_unique<PhysicsController>(1);
+        multiController_ = std::make_unique<PhysicsController>(6);
+        boxModel_ = std::make_shared<Polygon>();
+        vector<float> boxVertices = {
+            -0.5f, -0.5f, -0.5f,
+            0.5f, 0.5f, 0.5f
+        };
+        boxModel_->modelMap["box"] = std::make_shared<Model>(boxVertices.size() / 3, boxVertices);
+        buildScene(singleController_.get(), &singleObjects_);
+        buildScene(multiController_.get(), &multiObjects_);
+    }
+
+    // A static floor with boxes dropped onto it and thrown into each other
+    void buildScene(PhysicsController *controller, vector<std::shared_ptr<TestObject>> *objects) {
+        controller->setDeterministic(stepHz_);
+        auto floor = std::make_shared<TestObject>(boxModel_, "floor");
+        floor->createCollider("floor");
+        floor->setScale(40.0f);
+        floor->setPosition(vec3(0.0f, -20.0f, 0.0f));
+        controller->addSceneObject(floor.get(), {
+            .isKinematic = false,
+            .obeyGravity = false,
+            .elasticity = 0.0f,
+            .mass = testMassKg
+        });
+        objects->push_back(floor);
+        std::mt19937 rng(99);
+        std::uniform_real_distribution<float> position(-4.0f, 4.0f);
+        std::uniform_real_distribution<float> speed(-3.0f, 3.0f);
+        for (int i = 0; i < boxCount_; ++i) {
+            auto name = "box-" + to_string(i);
+            auto box = std::make_shared<TestObject>(boxModel_, name);
+            box->createCollider("box");
+            controller->addSceneObject(box.get(), {
+                .isKinematic = true,
+                .obeyGravity = (i % 2) == 0,
+                .elasticity = 0.0f,
+                .mass = testMassKg
+            });
+            controller->setPosition(name, vec3(position(rng), position(rng) + 5.0f, position(rng)));
+            controller->setVelocity(name, vec3(speed(rng), speed(rng), speed(rng)));
+            objects->push_back(box);
+        }
+    }
+    std::unique_ptr<PhysicsController> singleController_;
+    std::unique_ptr<PhysicsController> multiController_;
+    vector<std::shared_ptr<TestObject>> singleObjects_;
+    vector<std::shared_ptr<TestObject>> multiObjects_;
+    std::shared_ptr<Polygon> boxModel_;
+    inline static uint stepHz_ = 60;
+    inline static int boxCount_ = 64;
+};
+
+/**
+ * @brief Ensures two deterministic controllers on different thread counts stay bit identical every step, even when
+ * they are updated with different frame times.
+ */
+TEST_F(GivenDeterministicControllers, WhenUpdatedOnDifferentThreadCounts_ThenStateHashesMatchEveryStep) {
+    /* Preparation */
+    int updates = 90;
+    uint64_t startHash = multiController_->getStateHash();
+
+    /* Action / Validation */
+    for (int i = 0; i < updates; ++i) {
+        deltaTime = 0.01 * (i % 5);
+        singleController_->update();
+        deltaTime = 0.5;
+        multiController_->update();
+        ASSERT_EQ(singleController_->getStateHash(), multiController_->getStateHash()) << "Update " << i;
+    }
+    ASSERT_NE(startHash, multiController_->getStateHash());
+    ASSERT_EQ(1u, multiController_->getLastSubsteps());
+    for (uint i = 0; i < singleObjects_.size(); ++i) {
+        vec3 expectedPos = singleObjects_[i]->getPosition();
+        vec3 actualPos = multiObjects_[i]->getPosition();
+        ASSERT_VEC_EQ(expectedPos, actualPos);
+    }
+    // Some boxes should have come to rest on the floor rather than falling through it
+    ASSERT_GT(multiController_->getStats().contactsFound, 0u);
+}
+
+/**
+ * @brief Ensures a deterministic update advances exactly one step whatever the frame time, and that turning the mode
+ * off goes back to stepping by deltaTime.
+ */
+TEST_F(GivenTwoKinematicObjects, WhenDeterministicModeToggled_ThenStepIgnoresDeltaTimeOnlyWhileOn) {
+    /* Preparation */
+    physicsController_->setPosition(testObjectName, vec3(0.0f));
+    physicsController_->setPosition(otherObjectName, vec3(100.0f, 0.0f, 0.0f));
+    physicsController_->setVelocity(testObjectName, vec3(4.0f, 0.0f, 0.0f));
+    physicsController_->setDeterministic(4);
+    deltaTime = 3.0;
+
+    /* Action */
+    physicsController_->update();
+    auto deterministicPos = testObject_->getPosition();
+    physicsController_->setDeterministic(0);
+    physicsController_->update();
+
+    /* Validation */
+    ASSERT_FALSE(physicsController_->isDeterministic());
+    EXPECT_VEC_EQ(vec3(1.0f, 0.0f, 0.0f), deterministicPos);
+    EXPECT_VEC_EQ(vec3(13.0f, 0.0f, 0.0f), testObject_->getPosition());
+}
+
+/**
+ * @brief Ensures an update started with updateAsync leaves the targets and subscribers alone until sync, then moves
+ * the targets and delivers the step's contacts on the calling thread.
+ */
+TEST_F(GivenTwoKinematicObjects, WhenUpdateAsyncRunning_ThenTargetsUnchangedUntilSync) {
+    /* Preparation */
+    deltaTime = 1.0f;
+    vector<PhysicsReport> reports;
+    auto callingThread = std::this_thread::get_id();
+    bool deliveredOnCallingThread = true;
+    physicsController_->subscribe("test", [&](const PhysicsReport &report) {
+        deliveredOnCallingThread &= std::this_thread::get_id() == callingThread;
+        reports.push_back(report);
+    });
+    physicsController_->setPosition(testObjectName, vec3(0.0f));
+    physicsController_->setPosition(otherObjectName, vec3(basicModelOffset_ * 2 + 0.5f, 0.0f, 0.0f));
+    physicsController_->setVelocity(testObjectName, vec3(1.0f, 0.0f, 0.0f));
+    physicsController_->setVelocity(otherObjectName, vec3(-1.0f, 0.0f, 0.0f));
+
+    /* Action */
+    physicsController_->updateAsync();
+    // Wait for the steps themselves, so the only thing left for sync is publishing them
+    while (!physicsController_->isUpdateComplete()) {
+        std::this_thread::yield();
+    }
+    auto positionBeforeSync = testObject_->getPosition();
+    auto reportsBeforeSync = reports.size();
+    auto result = physicsController_->sync();
+
+    /* Validation */
+    EXPECT_VEC_EQ(vec3(0.0f), positionBeforeSync);
+    EXPECT_EQ(0, reportsBeforeSync);
+    ASSERT_EQ(PhysicsResult::OK, result);
+    EXPECT_NE(vec3(0.0f), testObject_->getPosition());
+    ASSERT_EQ(1, reports.size());
+    EXPECT_TRUE(deliveredOnCallingThread);
+    EXPECT_EQ(PhysicsResult::OK, physicsController_->sync());
+    EXPECT_EQ(1, reports.size());
+}
+
+/**
+ * @brief Ensures a body added and changed while an update is in flight is left out of that update, and joins the
+ * store with its changes at the start of the next one.
+ */
+TEST(GivenPhysicsControllerWithoutWorkers, WhenBodyAddedDuringUpdateAsync_ThenBodyJoinsNextUpdate) {
+    /* Preparation */
+    // Without workers the steps only run once sync waits for them, so the update stays in flight below
+    JobSystem jobSystem(0);
+    PhysicsController physicsController(&jobSystem);
+    PhysicsParams params = { .isKinematic = true, .obeyGravity = false, .elasticity = 0.0f, .mass = testMassKg };
+    auto firstObject = TestObject(TEST_OBJ_PRE("-first"));
+    auto lateObject = TestObject(TEST_OBJ_PRE("-late"));
+    firstObject.setPosition(vec3(0.0f));
+    lateObject.setPosition(vec3(0.0f));
+    physicsController.addSceneObject(&firstObject, params);
+    physicsController.update(FrameContext::fromDeltaTime(1.0));
+
+    /* Action */
+    physicsController.updateAsync(FrameContext::fromDeltaTime(1.0));
+    auto handle = physicsController.addSceneObject(&lateObject, params);
+    physicsController.setVelocity(lateObject.objectName(), vec3(2.0f, 0.0f, 0.0f));
+    auto bodiesInFlight = physicsController.getBodies().size();
+    physicsController.sync();
+    auto positionAfterFirstUpdate = lateObject.getPosition();
+    physicsController.update(FrameContext::fromDeltaTime(1.0));
+
+    /* Validation */
+    ASSERT_EQ(handle, physicsController.getHandle(lateObject.objectName()));
+    EXPECT_EQ(1u, bodiesInFlight);
+    EXPECT_VEC_EQ(vec3(0.0f), positionAfterFirstUpdate);
+    EXPECT_EQ(2u, physicsController.getBodies().size());
+    EXPECT_VEC_EQ(vec3(2.0f, 0.0f, 0.0f), lateObject.getPosition());
+}
+
+/**
+ * @brief Ensures a body removed while an update is in flight is out of the store by the time removeSceneObject
+ * returns, so its object can be destroyed straight away. The contact it made in that update is still reported, with
+ * the destroyed object left out.
+ */
+TEST_F(GivenTwoKinematicObjects, WhenBodyRemovedAndDestroyedDuringUpdateAsync_ThenObjectNeverTouchedAgain) {
+    /* Preparation */
+    deltaTime = 1.0f;
+    vector<PhysicsReport> reports;
+    physicsController_->subscribe("test", [&reports](const PhysicsReport &report) { reports.push_back(report); });
+    physicsController_->setPosition(testObjectName, vec3(0.0f));
+    physicsController_->setPosition(otherObjectName, vec3(basicModelOffset_ * 2 + 0.5f, 0.0f, 0.0f));
+    physicsController_->setVelocity(testObjectName, vec3(1.0f, 0.0f, 0.0f));
+    physicsController_->setVelocity(otherObjectName, vec3(-1.0f, 0.0f, 0.0f));
+
+    /* Action */
+    physicsController_->updateAsync();
+    auto result = physicsController_->removeSceneObject(otherObjectName);
+    auto bodiesAfterRemove = physicsController_->getBodies().size();
+    otherObject_.reset();
+    physicsController_->sync();
+
+    /* Validation */
+    ASSERT_EQ(PhysicsResult::OK, result);
+    EXPECT_EQ(1u, bodiesAfterRemove);
+    EXPECT_NE(vec3(0.0f), testObject_->getPosition());
+    ASSERT_EQ(1, reports.size());
+    ASSERT_EQ(1, reports[0].contacts.size());
+    auto &contact = reports[0].contacts[0];
+    EXPECT_TRUE(contact.bodyObject == testObject_.get() || contact.otherObject == testObject_.get());
+    EXPECT_TRUE(contact.bodyObject == nullptr || contact.otherObject == nullptr);
+}
+
+
+/**
+ * @brief Ensures an update steps by the scaled delta time of the FrameContext it is handed, ignoring the deltaTime
+ * global, and leaves bodies in place while the frame is paused.
+ */
+TEST_F(GivenTwoKinematicObjects, WhenUpdatedWithFrameContext_ThenScaledDeltaTimeUsedAndPausedFrameDoesNotMove) {
+    /* Preparation */
+    physicsController_->setPosition(testObjectName, vec3(0.0f));
+    physicsController_->setPosition(otherObjectName, vec3(100.0f, 0.0f, 0.0f));
+    physicsController_->setVelocity(testObjectName, vec3(4.0f, 0.0f, 0.0f));
+    deltaTime = 5.0f;
+    // Half a real second at half speed
+    auto frame = FrameContext().next(0.5, 0.5);
+
+    /* Action */
+    physicsController_->update(frame);
+    auto scaledPosition = testObject_->getPosition();
+    physicsController_->update(frame.next(0.5, 0.0));
+
+    /* Validation */
+    ASSERT_VEC_EQ(vec3(1.0f, 0.0f, 0.0f), scaledPosition);
+    ASSERT_VEC_EQ(vec3(1.0f, 0.0f, 0.0f), testObject_->getPosition());
+}
 /**
  * @brief Launches google test suite defined in file
  *
@@ -0,0 +1,160 @@
+/**
+ * @file RenderQueueTests.cpp
+ * @author Alec Jackson
+ * @brief Unit tests for the render queue sort keys and radix sort
+ * @version 0.1
+ * @date 2025
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include <RenderQueue.hpp>
+
+// Packets are only sorted, never drawn, so a counter stands in for each object
+static SceneObject *fakeObject(uintptr_t id) {
+    return reinterpret_cast<SceneObject *>(id + 1);
+}
+
+/**
+ * @brief Ensures render priority orders packets ahead of every other field, so priority semantics are unchanged.
+ */
+TEST(GivenPacketsWithDifferentPriorities, WhenSorted_ThenLowerPriorityFirstRegardlessOfState) {
+    /* Preparation */
+    RenderQueue queue;
+    queue.push(RenderPacket { RenderQueue::makeKey(40, 1, 1, 1, 0.0f), fakeObject(0) });
+    queue.push(RenderPacket { RenderQueue::makeKey(0, 900, 60000, 16000, 1.0f), fakeObject(1) });
+    queue.push(RenderPacket { RenderQueue::makeKey(20, 0, 0, 0, 0.5f), fakeObject(2) });
+
+    /* Action */
+    queue.sort();
+
+    /* Validation */
+    ASSERT_EQ(3u, queue.size());
+    EXPECT_EQ(fakeObject(1), queue.packets()[0].object);
+    EXPECT_EQ(fakeObject(2), queue.packets()[1].object);
+    EXPECT_EQ(fakeObject(0), queue.packets()[2].object);
+}
+
+/**
+ * @brief Ensures packets within a priority are grouped by program then texture, nearer packets first, and packets
+ * with equal keys keep the order they were pushed in.
+ */
+TEST(GivenInterleavedPacketsInOnePriority, WhenSorted_ThenGroupedByProgramAndTextureAndStable) {
+    /* Preparation */
+    RenderQueue queue;
+    queue.push(RenderPacket { RenderQueue::makeKey(20, 2, 5, 1, 0.5f), fakeObject(0) });
+    queue.push(RenderPacket { RenderQueue::makeKey(20, 1, 7, 1, 0.5f), fakeObject(1) });
+    queue.push(RenderPacket { RenderQueue::makeKey(20, 2, 5, 1, 0.5f), fakeObject(2) });
+    queue.push(RenderPacket { RenderQueue::makeKey(20, 1, 3, 1, 0.9f), fakeObject(3) });
+    queue.push(RenderPacket { RenderQueue::makeKey(20, 1, 3, 1, 0.1f), fakeObject(4) });
+
+    /* Action */
+    queue.sort();
+
+    /* Validation */
+    vector<SceneObject *> expected = { fakeObject(4), fakeObject(3), fakeObject(1), fakeObject(0), fakeObject(2) };
+    vector<SceneObject *> actual;
+    for (auto &packet : queue.packets()) actual.push_back(packet.object);
+    ASSERT_EQ(expected, actual);
+}
+
+/**
+ * @brief Ensures the radix sort produces the same order as a stable comparison sort on random keys.
+ */
+TEST(GivenRandomPackets, WhenSorted_ThenMatchesStableSort) {
+    /* Preparation */
+    std::mt19937 rng(99);
+    std::uniform_int_distribution<uint> priority(0, 100);
+    std::uniform_int_distribution<uint> id(0, 8);
+    std::uniform_real_distribution<float> depth(-0.5f, 1.5f);
+    RenderQueue queue;
+    vector<RenderPacket> expected;
+    for (uint i = 0; i < 5000; ++i) {
+        RenderPacket packet { RenderQueue::makeKey(priority(rng), id(rng), id(rng), id(rng), depth(rng)),
+            fakeObject(i) };
+        queue.push(packet);
+        expected.push_back(packet);
+    }
+    std::stable_sort(expected.begin(), expected.end(), [](const RenderPacket &a, const RenderPacket &b) {
+        return a.key < b.key;
+    });
+
+    /* Action */
+    queue.sort();
+
+    /* Validation */
+    ASSERT_EQ(expected.size(), queue.size());
+    for (uint i = 0; i < expected.size(); ++i) {
+        ASSERT_EQ(expected[i].key, queue.packets()[i].key) << "Packet " << i;
+        ASSERT_EQ(expected[i].object, queue.packets()[i].object) << "Packet " << i;
+    }
+}
+
+/**
+ * @brief Ensures depth outside of 0 to 1 is clamped rather than spilling into the VAO bits.
+ */
+TEST(GivenDepthOutOfRange, WhenKeyMade_ThenDepthClampedWithoutTouchingOtherFields) {
+    /* Preparation */
+    auto nearKey = RenderQueue::makeKey(10, 3, 4, 5, 0.0f);
+    auto farKey = RenderQueue::makeKey(10, 3, 4, 5, 1.0f);
+
+    /* Action */
+    auto belowKey = RenderQueue::makeKey(10, 3, 4, 5, -2.0f);
+    auto aboveKey = RenderQueue::makeKey(10, 3, 4, 5, 3.0f);
+
+    /* Validation */
+    EXPECT_EQ(nearKey, belowKey);
+    EXPECT_EQ(farKey, aboveKey);
+    EXPECT_LT(farKey, RenderQueue::makeKey(10, 3, 4, 6, 0.0f));
+}
+
+/**
+ * @brief Ensures blended packets sort far to near after the opaque packets of their priority, so the nearer one is
+ * painted over the farther one, while opaque packets keep sorting near to far.
+ */
+TEST(GivenBlendedAndOpaquePackets, WhenSorted_ThenOpaqueFrontToBackThenBlendedBackToFront) {
+    /* Preparation */
+    RenderQueue queue;
+    queue.push(RenderPacket { RenderQueue::makeBlendedKey(20, 0.2f, 0), fakeObject(0) });
+    queue.push(RenderPacket { RenderQueue::makeBlendedKey(20, 0.8f, 1), fakeObject(1) });
+    queue.push(RenderPacket { RenderQueue::makeKey(20, 1000, 60000, 16000, 0.8f), fakeObject(2) });
+    queue.push(RenderPacket { RenderQueue::makeKey(20, 1, 3, 1, 0.2f), fakeObject(3) });
+    queue.push(RenderPacket { RenderQueue::makeBlendedKey(10, 0.5f, 4), fakeObject(4) });
+
+    /* Action */
+    queue.sort();
+
+    /* Validation */
+    vector<SceneObject *> expected = { fakeObject(4), fakeObject(3), fakeObject(2), fakeObject(1), fakeObject(0) };
+    vector<SceneObject *> actual;
+    for (auto &packet : queue.packets()) actual.push_back(packet.object);
+    ASSERT_EQ(expected, actual);
+}
+
+/**
+ * @brief Ensures overlapping sprites at the same depth are painted in the order they were submitted, whatever
+ * texture each one binds, so an animated sprite switching textures never changes layers.
+ */
+TEST(GivenOverlappingSpritesWithDifferentTextures, WhenSorted_ThenSubmissionOrderKept) {
+    /* Preparation */
+    RenderQueue queue;
+    // An opaque key would draw the second sprite first, since it binds the lower texture id
+    ASSERT_LT(RenderQueue::makeKey(40, 1, 2, 1, 0.5f), RenderQueue::makeKey(40, 1, 9, 1, 0.5f));
+    queue.push(RenderPacket { RenderQueue::makeBlendedKey(40, 0.5f, 0), fakeObject(0) });
+    queue.push(RenderPacket { RenderQueue::makeBlendedKey(40, 0.5f, 1), fakeObject(1) });
+    queue.push(RenderPacket { RenderQueue::makeBlendedKey(40, 0.5f, 2), fakeObject(2) });
+
+    /* Action */
+    queue.sort();
+
+    /* Validation */
+    vector<SceneObject *> expected = { fakeObject(0), fakeObject(1), fakeObject(2) };
+    vector<SceneObject *> actual;
+    for (auto &packet : queue.packets()) actual.push_back(packet.object);
+    ASSERT_EQ(expected, actual);
+}
@@ -0,0 +1,193 @@
+/**
+ * @file SpriteBatchTests.cpp
+ * @author Alec Jackson
+ * @brief Unit tests for building, grouping and uploading 2D sprite batches
+ * @version 0.1
+ * @date 2025
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <memory>
+#include <vector>
+#include <SpriteBatch.hpp>
+#include <MockGfxController.hpp>
+
+using testing::_;
+using testing::InSequence;
+using testing::Pointee;
+
+const uint DUMMY_VAO = 0xBEEF;
+const uint DUMMY_BUFFER = 0xCAFE;
+const uint QUAD_VERTICES = 6;
+
+// Unit quad in the <vec2 pos, vec2 tex> layout sprites build
+const vector<float> UNIT_QUAD = {
+    0.0f, 1.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 1.0f,
+    1.0f, 1.0f, 1.0f, 0.0f,
+
+    1.0f, 1.0f, 1.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 1.0f,
+    1.0f, 0.0f, 1.0f, 1.0f
+};
+
+/**
+ * @brief Test fixture with a sprite batch drawn through a mock GfxController.
+ */
+class GivenASpriteBatch: public ::testing::Test {
+ protected:
+    void SetUp() override {
+        testing::DefaultValue<GfxResult<uint>>::Set(GFX_OK(uint));
+        ON_CALL(mockGfxController_, initVao(_)).WillByDefault([](uint *vao) {
+            *vao = DUMMY_VAO;
+            return GFX_OK(uint);
+        });
+        ON_CALL(mockGfxController_, generateBuffer(_)).WillByDefault([](uint *bufferId) {
+            *bufferId = DUMMY_BUFFER;
+            return GFX_OK(uint);
+        });
+    }
+    void TearDown() override {
+        testing::DefaultValue<GfxResult<uint>>::Clear();
+    }
+    void addQuads(uint texture, uint count) {
+        for (uint i = 0; i < count; ++i) {
+            spriteBatch_.add(texture, mat4(1.0f), UNIT_QUAD.data(), QUAD_VERTICES, vec4(0.0f));
+        }
+    }
+    testing::NiceMock<MockGfxController> mockGfxController_;
+    SpriteBatch spriteBatch_;
+};
+
+/**
+ * @brief Ensures sprites sharing a texture share a draw call, while the draw order of the sprites is kept.
+ */
+TEST_F(GivenASpriteBatch, WhenDrawn_ThenOneDrawPerTextureRunInOrder) {
+    /* Preparation */
+    addQuads(5, 2);
+    addQuads(7, 1);
+    addQuads(5, 1);
+    {
+        InSequence sequence;
+        EXPECT_CALL(mockGfxController_, bindTexture(5, GfxTextureType::NORMAL));
+        EXPECT_CALL(mockGfxController_, drawTrianglesRange(2 * QUAD_VERTICES, 0));
+        EXPECT_CALL(mockGfxController_, bindTexture(7, GfxTextureType::NORMAL));
+        EXPECT_CALL(mockGfxController_, drawTrianglesRange(QUAD_VERTICES, 2 * QUAD_VERTICES));
+        EXPECT_CALL(mockGfxController_, bindTexture(5, GfxTextureType::NORMAL));
+        EXPECT_CALL(mockGfxController_, drawTrianglesRange(QUAD_VERTICES, 3 * QUAD_VERTICES));
+        EXPECT_CALL(mockGfxController_, bindTexture(0, GfxTextureType::NORMAL));
+    }
+    EXPECT_CALL(mockGfxController_, drawTriangles(_)).Times(0);
+    EXPECT_CALL(mockGfxController_, clear(_)).Times(0);
+
+    /* Action */
+    spriteBatch_.draw(&mockGfxController_);
+
+    /* Validation */
+    EXPECT_EQ(3u, spriteBatch_.draws().size());
+    EXPECT_EQ(4 * QUAD_VERTICES, spriteBatch_.vertexCount());
+}
+
+/**
+ * @brief Ensures vertices are moved into world space with their texture coordinates intact, and every vertex
+ * carries the tint of its sprite.
+ */
+TEST_F(GivenASpriteBatch, WhenSpriteAdded_ThenVerticesTransformedAndTinted) {
+    /* Preparation */
+    auto model = glm::translate(mat4(1.0f), vec3(100.0f, 50.0f, 0.0f)) * glm::scale(vec3(2.0f));
+    auto tint = vec4(0.1f, 0.2f, 0.3f, 0.4f);
+    vector<vector<float>> uploads;
+    ON_CALL(mockGfxController_, updateBufferData(_, _)).WillByDefault(
+        [&uploads](const vector<float> &data, [[maybe_unused]] uint vbo) {
+            uploads.push_back(data);
+            return GFX_OK(uint);
+        });
+
+    /* Action */
+    spriteBatch_.add(1, model, UNIT_QUAD.data(), QUAD_VERTICES, tint);
+    spriteBatch_.draw(&mockGfxController_);
+
+    /* Validation */
+    ASSERT_EQ(2u, uploads.size());
+    auto &vertices = uploads[0];
+    auto &tints = uploads[1];
+    ASSERT_EQ(UNIT_QUAD.size(), vertices.size());
+    ASSERT_EQ(QUAD_VERTICES * SPRITE_BATCH_TINT_FLOATS, tints.size());
+    for (uint i = 0; i < QUAD_VERTICES; ++i) {
+        auto base = i * SPRITE_BATCH_VERTEX_FLOATS;
+        EXPECT_FLOAT_EQ(UNIT_QUAD[base] * 2.0f + 100.0f, vertices[base]) << "Vertex " << i;
+        EXPECT_FLOAT_EQ(UNIT_QUAD[base + 1] * 2.0f + 50.0f, vertices[base + 1]) << "Vertex " << i;
+        EXPECT_FLOAT_EQ(UNIT_QUAD[base + 2], vertices[base + 2]) << "Vertex " << i;
+        EXPECT_FLOAT_EQ(UNIT_QUAD[base + 3], vertices[base + 3]) << "Vertex " << i;
+        for (uint j = 0; j < SPRITE_BATCH_TINT_FLOATS; ++j) {
+            EXPECT_FLOAT_EQ(tint[j], tints[i * SPRITE_BATCH_TINT_FLOATS + j]) << "Vertex " << i;
+        }
+    }
+}
+
+/**
+ * @brief Ensures the buffers are created once, reused while the batch fits, and doubled when it outgrows them.
+ */
+TEST_F(GivenASpriteBatch, WhenDrawnOverSeveralFrames_ThenBuffersReusedAndGrown) {
+    /* Preparation */
+    EXPECT_CALL(mockGfxController_, initVao(_)).Times(1);
+    EXPECT_CALL(mockGfxController_, generateBuffer(_)).Times(2);
+    EXPECT_CALL(mockGfxController_, enableVertexAttArray(SPRITE_BATCH_VERTEX_ATTR, SPRITE_BATCH_VERTEX_FLOATS, _, _));
+    EXPECT_CALL(mockGfxController_, enableVertexAttArray(SPRITE_BATCH_TINT_ATTR, SPRITE_BATCH_TINT_FLOATS, _, _));
+    EXPECT_CALL(mockGfxController_, sendBufferData(_, _)).Times(0);
+    EXPECT_CALL(mockGfxController_, sendBufferDataDynamic(sizeof(float) * 4 * 2 * QUAD_VERTICES, nullptr)).Times(2);
+    EXPECT_CALL(mockGfxController_, sendBufferDataDynamic(sizeof(float) * 4 * 4 * QUAD_VERTICES, nullptr)).Times(2);
+    EXPECT_CALL(mockGfxController_, updateBufferData(_, DUMMY_BUFFER)).Times(6);
+
+    /* Action */
+    addQuads(1, 2);
+    spriteBatch_.draw(&mockGfxController_);
+    spriteBatch_.clear();
+    addQuads(1, 1);
+    spriteBatch_.draw(&mockGfxController_);
+    spriteBatch_.clear();
+    addQuads(1, 3);
+    spriteBatch_.draw(&mockGfxController_);
+
+    /* Validation */
+    EXPECT_EQ(3 * QUAD_VERTICES, spriteBatch_.vertexCount());
+}
+
+/**
+ * @brief Ensures the VAO and both buffers are deleted once the batch goes away.
+ */
+TEST_F(GivenASpriteBatch, WhenDestroyed_ThenVaoAndBuffersDeleted) {
+    /* Preparation */
+    auto spriteBatch = std::make_unique<SpriteBatch>();
+    spriteBatch->add(1, mat4(1.0f), UNIT_QUAD.data(), QUAD_VERTICES, vec4(0.0f));
+    spriteBatch->draw(&mockGfxController_);
+    EXPECT_CALL(mockGfxController_, deleteBuffer(Pointee(DUMMY_BUFFER))).Times(2);
+    EXPECT_CALL(mockGfxController_, deleteVao(Pointee(DUMMY_VAO))).Times(1);
+
+    /* Action */
+    spriteBatch.reset();
+}
+
+/**
+ * @brief Ensures drawing with another controller deletes the VAO and buffers from the old controller before creating
+ * new ones.
+ */
+TEST_F(GivenASpriteBatch, WhenDrawnWithAnotherController_ThenOldVaoAndBuffersDeleted) {
+    /* Preparation */
+    testing::NiceMock<MockGfxController> otherGfxController;
+    // Declared after the other controller, so the batch goes away first
+    SpriteBatch spriteBatch;
+    spriteBatch.add(1, mat4(1.0f), UNIT_QUAD.data(), QUAD_VERTICES, vec4(0.0f));
+    spriteBatch.draw(&mockGfxController_);
+    EXPECT_CALL(mockGfxController_, deleteBuffer(Pointee(DUMMY_BUFFER))).Times(2);
+    EXPECT_CALL(mockGfxController_, deleteVao(Pointee(DUMMY_VAO))).Times(1);
+    EXPECT_CALL(otherGfxController, initVao(_)).Times(1);
+    EXPECT_CALL(otherGfxController, generateBuffer(_)).Times(2);
+    EXPECT_CALL(otherGfxController, sendBufferDataDynamic(_, nullptr)).Times(2);
+
+    /* Action */
+    spriteBatch.draw(&otherGfxController);
+}
@@ -14,6 +14,7 @@
 #include <string>
 #include <memory>
 #include <atomic>
+#include <cstdint>
 #include <Polygon.hpp>
 #include <SceneObject.hpp>
 #include <GfxController.hpp>
@@ -27,6 +28,10 @@
 
 #define COLL_TRACE 0
 
+// Collision filtering - two colliders are only tested when each one's layer is in the other's mask
+#define COLLIDER_LAYER_DEFAULT 1u
+#define COLLIDER_MASK_ALL UINT32_MAX
+
 
 class ColliderObject : public SceneObject {
  public:
@@ -52,6 +57,13 @@ class ColliderObject : public SceneObject {
     inline const vec4 &originalCenter() { return originalCenter_; }
     static int getCollisionRaw(vec3 p1, ColliderObject *c1, vec3 p2, ColliderObject *c2);
     static vec4 createOffset(const mat4 &tm, const mat4 &sm, const vec4 &center, ColliderObject *col);
+    inline const string &tag() { return tag_; }
+    inline uint32_t layer() { return layer_; }
+    inline uint32_t mask() { return mask_; }
+    inline void setLayer(uint32_t layer) { layer_ = layer; }
+    inline void setMask(uint32_t mask) { mask_ = mask; }
+    // True when the two colliders accept each other's layers
+    inline bool canCollide(ColliderObject *other) { return (layer_ & other->mask_) && (other->layer_ & mask_); }
 
  private:
     vec4 offset_;
@@ -65,6 +77,8 @@ class ColliderObject : public SceneObject {
     const mat4 &pScaleMatrix_;
     const mat4 &pVpMatrix_;
     const string tag_;
+    uint32_t layer_ = COLLIDER_LAYER_DEFAULT;  // Bit identifying what kind of collider this is
+    uint32_t mask_ = COLLIDER_MASK_ALL;  // Layers this collider collides with
     int mvpId_;
     inline static std::atomic<bool> drawCollider_;
 };
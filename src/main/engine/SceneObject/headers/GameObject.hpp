@@ -18,6 +18,12 @@
 #include <ColliderExt.hpp>
 #include <winsup.hpp>
 
+// First of the four vec4 attributes holding a GameObject's instance model matrix
+#define GAMEOBJECT_INSTANCE_MODEL_ATTR 3
+#define GAMEOBJECT_INSTANCE_VEC4_COUNT 4
+// Smallest batch of GameObjects drawn instanced, smaller batches render one by one
+#define GAMEOBJECT_MIN_INSTANCES 2
+
 class GameObject: public SceneObject, public ColliderExt {
  public:
     // Constructurs
@@ -40,17 +46,41 @@ class GameObject: public SceneObject, public ColliderExt {
     inline std::shared_ptr<Polygon> getModel() { return model_; }
 
     // Other methods
+    using ColliderExt::createCollider;
     void createCollider(string tag) override;
     void configureOpenGl();
 
     void render() override;
     void update() override;
+    uint renderTexture() const override;
+    uint renderVao() const override;
+    /**
+     * @brief Checks whether another GameObject can share an instanced draw with this one. Both must be visible, share
+     * the same Polygon and program, and send the same lighting uniforms.
+     * @param other GameObject to compare against.
+     * @return true when both can be drawn by one updateInstanced call.
+     */
+    bool canInstanceWith(const GameObject &other) const;
+    /**
+     * @brief Updates a batch of GameObjects and draws each model of their shared Polygon once with
+     * drawTrianglesInstanced, instead of once per object. Lighting uniforms and the VP matrix are taken from the
+     * first object of the batch.
+     * @param batch GameObjects that all pass canInstanceWith against the first one.
+     */
+    static void updateInstanced(const vector<GameObject *> &batch);
 
  private:
+    /**
+     * @brief Uploads the model matrices of an instanced batch into the model's instance buffer, creating the buffer
+     * and attaching it to the model's VAO the first time.
+     * @param model Model to upload the matrices for.
+     * @param instanceData Model matrices of the batch, 16 floats per object.
+     */
+    void uploadInstanceData(Model *model, const vector<float> &instanceData);
     std::shared_ptr<Polygon> model_;
 
     unsigned int vpId, modelId,
-        hasTextureId, directionalLightId, luminanceId, rollOffId;
+        hasTextureId, directionalLightId, luminanceId, rollOffId, instancedId;
 
     float luminance;
     float rollOff;
@@ -17,6 +17,10 @@
 #include <ColliderExt.hpp>
 #include <TrackExt.hpp>
 #include <ImageExt.hpp>
+#include <SpriteBatch.hpp>
+
+// Smallest batch of 2D objects drawn through a SpriteBatch, smaller batches render one by one
+#define GAMEOBJECT2D_MIN_BATCH 2
 
 class GameObject2D : public SceneObject, public TrackExt, public ImageExt, public ColliderExt {
  public:
@@ -28,14 +32,37 @@ class GameObject2D : public SceneObject, public TrackExt, public ImageExt, publi
     // Render method
     void render() override;
     void update() override;
+    uint renderTexture() const override;
+    inline uint renderVao() const override { return vao_; }
     void initializeTextureData();
     virtual void initializeShaderVars() = 0;
     void initializeVertexData();
+    using ColliderExt::createCollider;
     void createCollider(string tag) override;
     void setDimensions(int width, int height);
     void swapTexture(string texturePath);
+    /**
+     * @brief Checks whether another 2D object can share a batched draw with this one. Both must be visible, and share
+     * the same program, render priority and VP matrix.
+     * @param other Object to compare against.
+     * @return true when both can be drawn by one updateBatched call.
+     */
+    bool canBatchWith(const GameObject2D &other) const;
+    /**
+     * @brief Updates a batch of 2D objects and draws them through a SpriteBatch, with one draw call per texture
+     * instead of one per object. The program and VP matrix are taken from the first object of the batch.
+     * @param batch Objects that all pass canBatchWith against the first one, in the order to draw them.
+     * @param spriteBatch Batch to build the vertices in, reused between frames.
+     */
+    static void updateBatched(const vector<GameObject2D *> &batch, SpriteBatch *spriteBatch);
 
  protected:
+    /**
+     * @brief Adds the triangles of this object to a SpriteBatch, with the object's texture, tint and transform.
+     * @param spriteBatch Batch to add to.
+     */
+    virtual void addToBatch(SpriteBatch *spriteBatch) = 0;
+
     string texturePath_;
     vector<float> vertTexData_;
 
@@ -43,6 +70,7 @@ class GameObject2D : public SceneObject, public TrackExt, public ImageExt, publi
     unsigned int modelMatId_;
     unsigned int projectionId_;
     unsigned int tintId_;
+    unsigned int batchedId_ = UINT_MAX;
 
     unsigned int vao_;
     unsigned int vbo_;
@@ -12,6 +12,7 @@
 #include <set>
 #include <common.hpp>
 #include <GfxController.hpp>
+#include <RenderQueue.hpp>
 
 /* Define constants for shader names */
 #define UIOBJECT_PROG_NAME "uiObject"
@@ -121,12 +122,31 @@ class SceneObject {
 
     // no-op by default
     virtual inline void finalize() {}
+    /**
+     * @brief Builds the packet the GameScene queues to draw this object. 3D objects sort by render priority, program,
+     * texture and VAO, then front to back by the depth of the object's position through the current VP matrix. 2D
+     * objects are blended, so they sort by render priority, then back to front depth and submission order.
+     * @param sequence Order the object was submitted in this frame.
+     * @return Packet for this frame's RenderQueue.
+     */
+    RenderPacket renderPacket(uint64_t sequence);
+    /**
+     * @brief Texture bound first when rendering, used to group objects sharing a texture. 0 when there is none.
+     */
+    virtual inline uint renderTexture() const { return 0; }
+    /**
+     * @brief VAO bound first when rendering, used to group objects sharing a VAO.
+     */
+    virtual inline uint renderVao() const { return vao_; }
 
     // Interface methods
     virtual void render() = 0;
     virtual void update() = 0;
 
  protected:
+    // Same test as VISIBILITY_CHECK, for batched draws that render objects outside of render()
+    inline bool isRendered() const { return (visible_ && !(parent_ && !parent_->visible())) || visPerm_; }
+
     mat4 translateMatrix_;
     mat4 scaleMatrix_;
     mat4 rotateMatrix_;
@@ -138,8 +158,8 @@ class SceneObject {
 
     const string objectName_;
     float scale_;
-    unsigned int programId_;
-    unsigned int vao_;
+    unsigned int programId_ = 0;
+    unsigned int vao_ = 0;
     ObjectType type_;
 
     uint renderPriority_ = RENDER_PRIOR_HIGH;
@@ -31,4 +31,7 @@ class SpriteObject : public GameObject2D {
 
     // AnimationFuncs
     void createAnimation(int width, int height, int frameCount) override;
+
+ protected:
+    void addToBatch(SpriteBatch *spriteBatch) override;
 };
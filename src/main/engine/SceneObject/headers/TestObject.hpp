@@ -28,6 +28,7 @@ class TestObject : public SceneObject, public ColliderExt {
     explicit TestObject(std::shared_ptr<Polygon> polygon, string name);
     void render() override;
     void update() override;
+    using ColliderExt::createCollider;
     void createCollider(string tag) override;
     inline const mat4 &getTranslationMatrix() { return translateMatrix_; }
     inline const mat4 &getRotationMatrix() { return rotateMatrix_; }
@@ -28,6 +28,7 @@ class TileObject : public SceneObject, public ImageExt {
         GfxController *gfxController);
     void update() override;
     void render() override;
+    inline uint renderTexture() const override { return texArr_; }
 
  private:
     void generateTextureData(map<string, string> textures);
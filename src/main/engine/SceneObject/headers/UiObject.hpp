@@ -48,7 +48,16 @@ class UiObject : public GameObject2D {
     // Animation functions
     void createAnimation(int width, int height, int frameCount) override;
 
+ protected:
+    void addToBatch(SpriteBatch *spriteBatch) override;
+
  private:
+    /**
+     * @brief Applies the stretch of the nine-slice quads to a copy of the vertex data, as stretchTriangle does in the
+     * uiObject shader for single draws. The edge quads keep their size, the center row and column grow.
+     */
+    void stretchVertices();
+
     unsigned int wScaleId_;
     unsigned int hScaleId_;
     unsigned int vertexIndexId_;
@@ -56,6 +65,7 @@ class UiObject : public GameObject2D {
 
     std::shared_ptr<float[]> vertexData_;
     std::shared_ptr<float[]> vertexIndexData_;
+    vector<float> batchVertices_;  // Stretched vertices for batched draws, kept to avoid allocating every frame
 
     float wScale_;
     float hScale_;
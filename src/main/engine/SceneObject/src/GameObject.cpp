@@ -48,6 +48,7 @@ GameObject::GameObject(std::shared_ptr<Polygon> characterModel, vec3 position, v
     directionalLightId = gfxController_->getShaderVariable(programId_, "directionalLight").get();
     luminanceId = gfxController_->getShaderVariable(programId_, "luminance").get();
     rollOffId = gfxController_->getShaderVariable(programId_, "rollOff").get();
+    instancedId = gfxController_->getShaderVariable(programId_, "instanced").get();
     vpMatrix_ = mat4(1.0f);  // Default VP matrix to identity matrix
 }
 
@@ -67,6 +68,12 @@ void GameObject::configureOpenGl() {
         model_.get()->modelMap.size());
     for (auto &modelPair : model_->modelMap) {
         gfxController_->initVao(&modelPair.second.get()->vao);
+        // The instance buffer was attached to the previous VAO, attach a new one on the next instanced draw
+        if (modelPair.second.get()->instanceBufferId != UINT_MAX) {
+            gfxController_->deleteBuffer(&modelPair.second.get()->instanceBufferId);
+        }
+        modelPair.second.get()->instanceBufferId = UINT_MAX;
+        modelPair.second.get()->instanceCapacity = 0;
         gfxController_->bindVao(modelPair.second.get()->vao);
         // Generate vertex buffer
         gfxController_->generateBuffer(&modelPair.second.get()->shapeBufferId);
@@ -158,6 +165,23 @@ void GameObject::createCollider(string tag) {
     collider_ = std::make_shared<ColliderObject>(tag, this->getModel(), colliderProg.get(), this);
 }
 
+/**
+ * @brief Texture of the first model drawn by render, or 0 when it is untextured.
+ */
+uint GameObject::renderTexture() const {
+    if (model_.get() == nullptr || model_.get()->modelMap.empty()) return 0;
+    auto &model = model_.get()->modelMap.begin()->second;
+    return model.get()->textureCoordsId != UINT_MAX ? model.get()->textureId : 0;
+}
+
+/**
+ * @brief VAO of the first model drawn by render.
+ */
+uint GameObject::renderVao() const {
+    if (model_.get() == nullptr || model_.get()->modelMap.empty()) return 0;
+    return model_.get()->modelMap.begin()->second.get()->vao;
+}
+
 void GameObject::update() {
     // Update our model transformation matrices
     updateModelMatrices();
@@ -197,3 +221,78 @@ void GameObject::render() {
     }
     if (collider_.use_count() > 0) collider_.get()->update();
     }
+
+bool GameObject::canInstanceWith(const GameObject &other) const {
+    // Shaders without the instanced uniform can only draw through the model uniform
+    return instancedId != UINT_MAX && model_.get() != nullptr && model_ == other.model_ &&
+        programId_ == other.programId_ &&
+        isRendered() && other.isRendered() && luminance == other.luminance && rollOff == other.rollOff &&
+        directionalLight == other.directionalLight;
+}
+
+void GameObject::updateInstanced(const vector<GameObject *> &batch) {
+    if (batch.empty()) return;
+    auto first = batch.front();
+    auto gfxController = first->gfxController_;
+    vector<float> instanceData;
+    instanceData.reserve(batch.size() * 16);
+    for (auto object : batch) {
+        object->updateModelMatrices();
+        auto modelMatrix = object->translateMatrix_ * object->rotateMatrix_ * object->scaleMatrix_;
+        auto matrixData = glm::value_ptr(modelMatrix);
+        instanceData.insert(instanceData.end(), matrixData, matrixData + 16);
+    }
+    auto instanceCount = static_cast<uint>(batch.size());
+    gfxController->setProgram(first->programId_);
+    gfxController->polygonRenderMode(RenderMode::FILL);
+    gfxController->sendFloat(first->luminanceId, first->luminance);
+    gfxController->sendFloat(first->rollOffId, first->rollOff);
+    gfxController->sendFloatVector(first->directionalLightId, 1, VectorType::GFX_3D,
+        glm::value_ptr(first->directionalLight));
+    gfxController->sendFloatMatrix(first->vpId, 1, glm::value_ptr(first->vpMatrix_));
+    gfxController->sendInteger(first->instancedId, 1);
+    for (auto &modelPair : first->model_.get()->modelMap) {
+        auto model = modelPair.second.get();
+        int hasTexture = model->textureCoordsId != UINT_MAX ? 1 : 0;
+        first->uploadInstanceData(model, instanceData);
+        gfxController->sendInteger(first->hasTextureId, hasTexture);
+        gfxController->bindVao(model->vao);
+        if (hasTexture) {
+            gfxController->sendInteger(first->model_.get()->textureUniformId, 0);
+            gfxController->bindTexture(model->textureId, GfxTextureType::NORMAL);
+        }
+        gfxController->drawTrianglesInstanced(model->pointCount * 3, instanceCount);
+        gfxController->bindVao(0);
+    }
+    // Single objects keep using the model uniform
+    gfxController->sendInteger(first->instancedId, 0);
+    for (auto object : batch) {
+        if (object->collider_.use_count() > 0) object->collider_.get()->update();
+    }
+}
+
+void GameObject::uploadInstanceData(Model *model, const vector<float> &instanceData) {
+    auto instanceCount = static_cast<uint>(instanceData.size() / 16);
+    if (model->instanceBufferId == UINT_MAX) {
+        gfxController_->generateBuffer(&model->instanceBufferId);
+        gfxController_->bindVao(model->vao);
+        gfxController_->bindBuffer(model->instanceBufferId);
+        gfxController_->sendBufferData(sizeof(float) * instanceData.size(), const_cast<float *>(instanceData.data()));
+        for (uint i = 0; i < GAMEOBJECT_INSTANCE_VEC4_COUNT; ++i) {
+            auto layout = GAMEOBJECT_INSTANCE_MODEL_ATTR + i;
+            gfxController_->enableVertexAttArray(layout, 4, sizeof(vec4), reinterpret_cast<void *>(i * sizeof(vec4)));
+            gfxController_->setVertexAttDivisor(layout, 1);
+        }
+        gfxController_->bindBuffer(0);
+        gfxController_->bindVao(0);
+        model->instanceCapacity = instanceCount;
+    } else if (instanceCount > model->instanceCapacity) {
+        // The VAO points at the buffer rather than its storage, so growing it keeps the attributes attached
+        gfxController_->bindBuffer(model->instanceBufferId);
+        gfxController_->sendBufferData(sizeof(float) * instanceData.size(), const_cast<float *>(instanceData.data()));
+        gfxController_->bindBuffer(0);
+        model->instanceCapacity = instanceCount;
+    } else {
+        gfxController_->updateBufferData(instanceData, model->instanceBufferId);
+    }
+}
@@ -28,6 +28,7 @@ void GameObject2D::initializeShaderVars() {
     projectionId_ = gfxController_->getShaderVariable(programId_, "projection").get();
     modelMatId_ = gfxController_->getShaderVariable(programId_, "model").get();
     tintId_ = gfxController_->getShaderVariable(programId_, "tint").get();
+    batchedId_ = gfxController_->getShaderVariable(programId_, "batched").get();
 }
 
 void GameObject2D::initializeTextureData() {
@@ -89,6 +90,14 @@ void GameObject2D::render() {
     printf("GameObject2D::render: Base GameObject2D render called, rendering nothing\n");
 }
 
+/**
+ * @brief Texture render binds, the current frame of the image bank when it has one.
+ */
+uint GameObject2D::renderTexture() const {
+    if (imageBank_.textureIds.empty() || currentFrame_ >= imageBank_.textureIds.size()) return textureId_;
+    return imageBank_.textureIds.at(currentFrame_);
+}
+
 void GameObject2D::update() {
     render();
 }
@@ -109,3 +118,37 @@ void GameObject2D::createCollider(string tag) {
     }
     collider_ = std::make_shared<ColliderObject>(tag, vertTexData_, colliderProg.get(), this);
 }
+
+bool GameObject2D::canBatchWith(const GameObject2D &other) const {
+    // Shaders without the batched uniform can only draw through the model uniform
+    return batchedId_ != UINT_MAX && programId_ == other.programId_ && renderPriority_ == other.renderPriority_ &&
+        vpMatrix_ == other.vpMatrix_ && isRendered() && other.isRendered();
+}
+
+void GameObject2D::updateBatched(const vector<GameObject2D *> &batch, SpriteBatch *spriteBatch) {
+    if (batch.empty()) return;
+    auto first = batch.front();
+    auto gfxController = first->gfxController_;
+    spriteBatch->clear();
+    for (auto object : batch) {
+        object->updateModelMatrices();
+        std::unique_lock<std::mutex> scopeLock(object->objectLock_);
+        object->addToBatch(spriteBatch);
+    }
+    gfxController->setProgram(first->programId_);
+    gfxController->polygonRenderMode(RenderMode::FILL);
+    gfxController->sendFloatMatrix(first->projectionId_, 1, glm::value_ptr(first->vpMatrix_));
+    gfxController->sendInteger(first->batchedId_, 1);
+    /*
+     * Each object used to clear the depth buffer before drawing so it landed on top of everything before it. The
+     * batch is drawn in order, so skipping the depth test gives the same result without a clear per object.
+     */
+    gfxController->setCapability(GfxCapability::DEPTH_TEST, false);
+    spriteBatch->draw(gfxController);
+    gfxController->setCapability(GfxCapability::DEPTH_TEST, true);
+    // Single objects keep using the model and tint uniforms
+    gfxController->sendInteger(first->batchedId_, 0);
+    for (auto object : batch) {
+        if (object->collider_.use_count() > 0) object->collider_.get()->update();
+    }
+}
@@ -21,6 +21,18 @@ void SceneObject::updateModelMatrices() {
     scaleMatrix_ = glm::scale(mat4(1.0f), vec3(scale));
 }
 
+RenderPacket SceneObject::renderPacket(uint64_t sequence) {
+    // Normalized device depth of the object's origin, mapped to 0 (near) to 1 (far). Behind the camera sorts last.
+    auto clip = vpMatrix_ * vec4(getPosition(), 1.0f);
+    float depth = clip.w > 0.0f ? clip.z / clip.w * 0.5f + 0.5f : 1.0f;
+    // 2D objects are alpha blended, so they keep painter's order instead of being grouped by state
+    if (type_ == SPRITE_OBJECT || type_ == UI_OBJECT || type_ == TEXT_OBJECT || type_ == TILE_OBJECT) {
+        return RenderPacket { RenderQueue::makeBlendedKey(renderPriority_, depth, sequence), this };
+    }
+    auto key = RenderQueue::makeKey(renderPriority_, programId_, renderTexture(), renderVao(), depth);
+    return RenderPacket { key, this };
+}
+
 void SceneObject::addChild(SceneObject *child) {
     if (nullptr == child) {
         fprintf(stderr, "SceneObject::addChild: Passed in child is null!\n");
@@ -108,6 +108,12 @@ void SpriteObject::update() {
     render();
 }
 
+void SpriteObject::addToBatch(SpriteBatch *spriteBatch) {
+    mat4 model = translateMatrix_ * rotateMatrix_ * scaleMatrix_;
+    spriteBatch->add(renderTexture(), model, vertTexData_.data(), vertTexData_.size() / SPRITE_BATCH_VERTEX_FLOATS,
+        tint_);
+}
+
 void SpriteObject::createAnimation(int width, int height, int frameCount) {
     splitGrid(width, height, frameCount);
 
@@ -172,6 +172,32 @@ void UiObject::update() {
     render();
 }
 
+void UiObject::addToBatch(SpriteBatch *spriteBatch) {
+    stretchVertices();
+    // Do not use the normal scale for UI - scale is used for initialization only
+    auto model = translateMatrix_ * rotateMatrix_;
+    spriteBatch->add(renderTexture(), model, batchVertices_.data(),
+        POINTS_PER_TRIANGLE * TRIANGLES_PER_QUAD * QUADS_PER_UI_ELEM, tint_);
+}
+
+void UiObject::stretchVertices() {
+    auto pointsPerQuad = POINTS_PER_TRIANGLE * TRIANGLES_PER_QUAD;
+    auto vertexCount = pointsPerQuad * QUADS_PER_UI_ELEM;
+    batchVertices_.assign(vertexData_.get(), vertexData_.get() + vertexCount * SPRITE_BATCH_VERTEX_FLOATS);
+    for (int i = 0; i < vertexCount; ++i) {
+        // Quads run left to right from the top row of the 3x3 grid
+        auto quad = i / pointsPerQuad;
+        auto column = quad % 3;
+        auto row = quad / 3;
+        // Vertices 2, 3 and 5 of each quad sit on its right edge, vertices 0, 2 and 3 on its top edge
+        auto vertex = i % pointsPerQuad;
+        bool right = vertex == 2 || vertex == 3 || vertex == 5;
+        bool top = vertex == 0 || vertex == 2 || vertex == 3;
+        if (column == 2 || (column == 1 && right)) batchVertices_[i * SPRITE_BATCH_VERTEX_FLOATS] += wScale_;
+        if (row == 0 || (row == 1 && top)) batchVertices_[i * SPRITE_BATCH_VERTEX_FLOATS + 1] += hScale_;
+    }
+}
+
 void UiObject::finalize() {
     reinitializeVertexData();
 }
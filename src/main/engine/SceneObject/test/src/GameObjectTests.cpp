@@ -0,0 +1,176 @@
+/**
+ * @file GameObjectTests.cpp
+ * @author Alec Jackson
+ * @brief Unit tests for instanced rendering of GameObjects sharing a Polygon
+ * @version 0.1
+ * @date 2025
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include <GameObject.hpp>
+#include <MockGfxController.hpp>
+
+using testing::_;
+using testing::Pointee;
+
+const uint DUMMY_VAO = 0xBEEF;
+const uint DUMMY_INSTANCE_BUFFER = 0xCAFE;
+const uint DUMMY_PROGRAM = 3;
+const uint TRIANGLE_POINTS = 3;
+
+/**
+ * @brief Launches google test suite defined in file
+ *
+ * @param argc
+ * @param argv
+ * @return int
+ */
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    cout << "Running GTESTS" << endl;
+    auto result = RUN_ALL_TESTS();
+    if (!result) {
+        cout << "All tests passed" << endl;
+    } else {
+        cout << "Some test failures detected!" << endl;
+    }
+
+    return result;
+}
+
+/**
+ * @brief Test fixture with three GameObjects built from one Polygon holding two models.
+ */
+class GivenGameObjectsSharingAPolygon: public ::testing::Test {
+ protected:
+    void SetUp() override {
+        testing::DefaultValue<GfxResult<uint>>::Set(GFX_OK(uint));
+        testing::DefaultValue<GfxResult<int>>::Set(GFX_OK(int));
+        ON_CALL(mockGfxController_, initVao(_)).WillByDefault([](uint *vao) {
+            *vao = DUMMY_VAO;
+            return GFX_OK(uint);
+        });
+        ON_CALL(mockGfxController_, generateBuffer(_)).WillByDefault([](uint *bufferId) {
+            *bufferId = DUMMY_INSTANCE_BUFFER;
+            return GFX_OK(uint);
+        });
+        polygon_ = std::make_shared<Polygon>();
+        vector<float> vertices(TRIANGLE_POINTS * 3, 0.0f);
+        polygon_->modelMap["first"] = std::make_shared<Model>(1, vertices);
+        polygon_->modelMap["second"] = std::make_shared<Model>(1, vertices);
+        for (uint i = 0; i < 3; ++i) {
+            objects_.push_back(std::make_unique<GameObject>(polygon_, vec3(i, 0.0f, 0.0f), vec3(0.0f), 1.0f,
+                DUMMY_PROGRAM, "object-" + std::to_string(i), GAME_OBJECT, &mockGfxController_));
+        }
+        for (auto &object : objects_) batch_.push_back(object.get());
+    }
+    void TearDown() override {
+        objects_.clear();
+        testing::DefaultValue<GfxResult<uint>>::Clear();
+        testing::DefaultValue<GfxResult<int>>::Clear();
+    }
+    testing::NiceMock<MockGfxController> mockGfxController_;
+    std::shared_ptr<Polygon> polygon_;
+    vector<std::unique_ptr<GameObject>> objects_;
+    vector<GameObject *> batch_;
+};
+
+/**
+ * @brief Ensures a batch draws each model once with every object as an instance, instead of once per object.
+ */
+TEST_F(GivenGameObjectsSharingAPolygon, WhenUpdatedInstanced_ThenOneInstancedDrawPerModel) {
+    /* Preparation */
+    EXPECT_CALL(mockGfxController_, drawTriangles(_)).Times(0);
+    EXPECT_CALL(mockGfxController_, drawTrianglesInstanced(TRIANGLE_POINTS, batch_.size())).Times(2);
+    // Instance matrices attach to the VAO of each model once
+    for (uint i = 0; i < GAMEOBJECT_INSTANCE_VEC4_COUNT; ++i) {
+        EXPECT_CALL(mockGfxController_, setVertexAttDivisor(GAMEOBJECT_INSTANCE_MODEL_ATTR + i, 1)).Times(2);
+    }
+
+    /* Action */
+    GameObject::updateInstanced(batch_);
+
+    /* Validation */
+    for (auto &modelPair : polygon_->modelMap) {
+        EXPECT_EQ(DUMMY_INSTANCE_BUFFER, modelPair.second->instanceBufferId);
+        EXPECT_EQ(batch_.size(), modelPair.second->instanceCapacity);
+    }
+}
+
+/**
+ * @brief Ensures later frames reuse the instance buffer, and only reallocate it when the batch outgrows it.
+ */
+TEST_F(GivenGameObjectsSharingAPolygon, WhenUpdatedInstancedAgain_ThenInstanceBufferReused) {
+    /* Preparation */
+    vector<GameObject *> smallerBatch(batch_.begin(), batch_.begin() + 2);
+    GameObject::updateInstanced(batch_);
+    EXPECT_CALL(mockGfxController_, generateBuffer(_)).Times(0);
+    EXPECT_CALL(mockGfxController_, sendBufferData(_, _)).Times(0);
+    EXPECT_CALL(mockGfxController_, updateBufferData(_, DUMMY_INSTANCE_BUFFER))
+        .Times(2)
+        .WillRepeatedly([](const vector<float> &data, [[maybe_unused]] uint vbo) {
+            EXPECT_EQ(2 * 16, data.size());
+            return GFX_OK(uint);
+        });
+    EXPECT_CALL(mockGfxController_, drawTrianglesInstanced(TRIANGLE_POINTS, 2)).Times(2);
+
+    /* Action */
+    GameObject::updateInstanced(smallerBatch);
+
+    /* Validation */
+    for (auto &modelPair : polygon_->modelMap) {
+        EXPECT_EQ(batch_.size(), modelPair.second->instanceCapacity);
+    }
+}
+
+/**
+ * @brief Ensures objects only share a draw when nothing they send to the shader differs.
+ */
+TEST_F(GivenGameObjectsSharingAPolygon, WhenStateDiffers_ThenObjectsNotInstancedTogether) {
+    /* Preparation */
+    auto otherPolygon = std::make_shared<Polygon>();
+    otherPolygon->modelMap["other"] = std::make_shared<Model>(1, vector<float>(TRIANGLE_POINTS * 3, 0.0f));
+    GameObject otherModel(otherPolygon, vec3(0.0f), vec3(0.0f), 1.0f, DUMMY_PROGRAM, "other", GAME_OBJECT,
+        &mockGfxController_);
+
+    /* Action */
+    auto sameState = objects_[0]->canInstanceWith(*objects_[1]);
+    objects_[1]->setLuminance(0.5f);
+    auto differentLuminance = objects_[0]->canInstanceWith(*objects_[1]);
+    objects_[2]->setVisible(false);
+    auto hidden = objects_[0]->canInstanceWith(*objects_[2]);
+    auto differentPolygon = objects_[0]->canInstanceWith(otherModel);
+
+    /* Validation */
+    EXPECT_TRUE(sameState);
+    EXPECT_FALSE(differentLuminance);
+    EXPECT_FALSE(hidden);
+    EXPECT_FALSE(differentPolygon);
+}
+
+/**
+ * @brief Ensures configuring another object with the shared Polygon frees the instance buffer of each model before
+ * dropping it, instead of leaking it.
+ */
+TEST_F(GivenGameObjectsSharingAPolygon, WhenPolygonConfiguredAgain_ThenInstanceBufferDeleted) {
+    /* Preparation */
+    GameObject::updateInstanced(batch_);
+    EXPECT_CALL(mockGfxController_, deleteBuffer(Pointee(DUMMY_INSTANCE_BUFFER))).Times(polygon_->modelMap.size());
+
+    /* Action */
+    GameObject lateObject(polygon_, vec3(0.0f), vec3(0.0f), 1.0f, DUMMY_PROGRAM, "late", GAME_OBJECT,
+        &mockGfxController_);
+
+    /* Validation */
+    for (auto &modelPair : polygon_->modelMap) {
+        EXPECT_EQ(UINT_MAX, modelPair.second->instanceBufferId);
+        EXPECT_EQ(0u, modelPair.second->instanceCapacity);
+    }
+}
@@ -16,6 +16,13 @@ class ColliderExt {
     int getCollision(ColliderExt *other);
     void updateCollider();
     virtual void createCollider(string tag) = 0;
+    /**
+     * @brief Creates the collider and sets its collision filter.
+     * @param tag Tag for the collider.
+     * @param layer Layer bits of the new collider.
+     * @param mask Layers the new collider collides with.
+     */
+    void createCollider(string tag, uint32_t layer, uint32_t mask);
     static int getCollisionRaw(vec3 p1, ColliderExt *c1, vec3 p2, ColliderExt *c2);
     static vec3 getEdgePointRaw(vec3 p1, ColliderObject *c1, vec3 p2, ColliderObject *c2, vec3 epSign);
     inline vec3 getCenter() { return collider_->center(); }
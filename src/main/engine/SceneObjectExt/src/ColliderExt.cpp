@@ -27,6 +27,13 @@ vec3 ColliderExt::getEdgePointRaw(vec3 p1, ColliderObject *c1, vec3 p2, Collider
     return ColliderObject::getEdgePointRaw(p1, c1, p2, c2, epSign);
 }
 
+void ColliderExt::createCollider(string tag, uint32_t layer, uint32_t mask) {
+    createCollider(tag);
+    if (collider_.get() == nullptr) return;
+    collider_->setLayer(layer);
+    collider_->setMask(mask);
+}
+
 void ColliderExt::updateCollider() {
     if (collider_.get() != nullptr) collider_->updateCollider();
 }
@@ -1,11 +1,18 @@
 #version 330 core
 layout (location = 0) in vec4 vertex; // <vec2 pos, vec2 tex>
+layout (location = 1) in vec4 vertexTint;
 out vec2 TexCoords;
+out vec4 Tint;
 
 uniform mat4 projection;
 uniform mat4 model;
+uniform vec4 tint;
+uniform int batched;
 
 void main() {
-    gl_Position = projection * model * vec4(vertex.xy, 0.0, 1.0);
+    // Batched vertices are already in world space and carry their own tint
+    mat4 modelMatrix = batched == 1 ? mat4(1.0) : model;
+    gl_Position = projection * modelMatrix * vec4(vertex.xy, 0.0, 1.0);
     TexCoords = vertex.zw;
+    Tint = batched == 1 ? vertexTint : tint;
 }
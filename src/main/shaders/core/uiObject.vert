@@ -1,13 +1,17 @@
 #version 330 core
 layout (location = 0) in vec4 vertex; // <vec2 pos, vec2 tex>
+layout (location = 1) in vec4 vertexTint;
 out vec2 TexCoords;
 out float TriDex;
 out vec4 tipColor;
+out vec4 Tint;
 
 uniform mat4 projection;
 uniform mat4 model;
 uniform float hScale;
 uniform float wScale;
+uniform vec4 tint;
+uniform int batched;
 
 vec4 modifiedPos;
 
@@ -123,8 +127,17 @@ int stretchTriangle(int index, float horizontalScale, float verticalScale) {
 }
 
 void main() {
-    int triangle = stretchTriangle(gl_VertexID, wScale, hScale);
-    gl_Position = projection * model * modifiedPos;
+    int triangle = 0;
+    if (batched == 1) {
+        // Batched vertices were stretched into world space on the CPU, gl_VertexID counts across every object
+        tipColor = vec4(1.0f, 1.0f, 1.0f, 1.0f);
+        gl_Position = projection * vec4(vertex.xy, 0.0, 1.0);
+        Tint = vertexTint;
+    } else {
+        triangle = stretchTriangle(gl_VertexID, wScale, hScale);
+        gl_Position = projection * model * modifiedPos;
+        Tint = tint;
+    }
     TexCoords = vertex.zw;
     TriDex = float(triangle);
 }
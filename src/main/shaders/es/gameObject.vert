@@ -5,9 +5,12 @@ precision mediump float;
 layout(location = 0) in vec3 vertexPosition_modelspace;
 layout(location = 1) in vec2 texcoord;
 layout(location = 2) in vec3 normals;
+// Per instance model matrix, read instead of model when instanced is 1
+layout(location = 3) in mat4 instanceModel;
 out vec2 f_texcoord;
 //out float brightness;
 uniform mat4 model;
+uniform int instanced;
 uniform mat4 VP;
 uniform vec3 directionalLight;
 uniform float rollOff;
@@ -19,13 +22,14 @@ const vec3 kd = 0.7*vec3(.5, 0.5, 0.5);
 
 void main() {
   vec3 lightPosition = directionalLight;
+  mat4 modelMatrix = instanced == 1 ? instanceModel : model;
 
-  vec4 normal = normalize(model * vec4(normals, 0.0));
+  vec4 normal = normalize(modelMatrix * vec4(normals, 0.0));
   const vec3 LightIntensity = vec3(40);
 
   float distance = length(lightPosition - vertexPosition_modelspace);
   float intensity = dot(normal, normalize(vec4(lightPosition, 0.0) - vec4(vertexPosition_modelspace, 1.0)));
-  gl_Position = VP * model * vec4(vertexPosition_modelspace, 1);
+  gl_Position = VP * modelMatrix * vec4(vertexPosition_modelspace, 1);
 
   f_texcoord = texcoord;
 
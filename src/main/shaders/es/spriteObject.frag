@@ -1,15 +1,15 @@
 #version 310 es
 precision mediump float;
 in vec2 TexCoords;
+in vec4 Tint;
 out vec4 color;
 
 uniform sampler2D sprite;
-uniform vec4 tint;
 
 void main() {
     vec4 texColor = texture(sprite, TexCoords);
     if (texColor.a < 0.1) {
         discard;
     }
-    color = texColor + vec4(tint);
+    color = texColor + Tint;
 }
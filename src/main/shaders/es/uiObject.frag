@@ -1,12 +1,12 @@
 #version 310 es
 precision mediump float;
 in vec2 TexCoords;
+in vec4 Tint;
 in float TriDex;
 in vec4 tipColor;
 out vec4 color;
 
 uniform sampler2D sprite;
-uniform vec4 tint;
 
 void main() {
     //int isolatedTriangles[5] = int[](1, 3, 4, 5, 7);
@@ -14,7 +14,7 @@ void main() {
     if (texColor.a < 0.1) {
         discard;
     }
-    color = texColor + tint;
+    color = texColor + Tint;
 #if 0
     int blank = 0;
     for (int i = 0; i < 5; ++i) {
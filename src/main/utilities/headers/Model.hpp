@@ -35,4 +35,6 @@ class Model {
     uint pointCount;  // no. of distinct points in shape
     string materialName;
     uint vao;
+    uint instanceBufferId = UINT_MAX;  // Model matrices of the GameObjects drawn instanced with this model
+    uint instanceCapacity = 0;  // Matrices the instance buffer has room for
 };
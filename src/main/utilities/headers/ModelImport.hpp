@@ -16,6 +16,7 @@
 #include <memory>
 #include <Polygon.hpp>
 #include <winsup.hpp>
+#include <JobSystem.hpp>
 #define DEFAULT_VECTOR_SIZE 256
 #define MAX_MAT_NAME_SIZE 64
 
@@ -32,4 +33,11 @@ enum class Result {
     FAILURE
 };
 std::shared_ptr<Polygon> createPolygonFromFile(string modelPath);
+/**
+ * @brief Loads several .obj files at once, parsing each file as its own job.
+ * @param modelPaths Paths of the models to load.
+ * @param jobSystem Job system to parse the files on. When nullptr, the files are loaded one after the other.
+ * @return Loaded polygons, in the same order as modelPaths.
+ */
+vector<std::shared_ptr<Polygon>> createPolygonsFromFiles(const vector<string> &modelPaths, JobSystem *jobSystem);
 };
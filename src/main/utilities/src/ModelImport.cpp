@@ -34,6 +34,24 @@ std::shared_ptr<Polygon> createPolygonFromFile(string modelPath) {
     return polygon;
 }
 
+vector<std::shared_ptr<Polygon>> createPolygonsFromFiles(const vector<string> &modelPaths, JobSystem *jobSystem) {
+    vector<std::shared_ptr<Polygon>> polygons(modelPaths.size());
+    if (nullptr == jobSystem) {
+        for (uint i = 0; i < modelPaths.size(); ++i) {
+            polygons[i] = createPolygonFromFile(modelPaths[i]);
+        }
+        return polygons;
+    }
+    // Parsing only touches the polygon being built, so every file can be its own job
+    auto loadJob = jobSystem->parallelFor(modelPaths.size(), 1, [&modelPaths, &polygons](uint begin, uint end) {
+        for (uint i = begin; i < end; ++i) {
+            polygons[i] = createPolygonFromFile(modelPaths[i]);
+        }
+    });
+    jobSystem->wait(loadJob);
+    return polygons;
+}
+
 Result processMaterialFile(string modelPath, std::shared_ptr<Polygon> polygon) {
     // Find the material path
     // Check if this works on Windows later